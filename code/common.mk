@@ -65,5 +65,7 @@ XMLLDFLAGS := -lxml2
 READLINECXXFLAGS :=
 READLINELDFLAGS := -lreadline
 
+THREADLDFLAGS := -lpthread
+
 GAMECXXFLAGS := $(CXXFLAGS) $(BOOSTCXXFLAGS) $(XMLCXXFLAGS) $(READLINECXXFLAGS)
-GAMELDFLAGS  := $(GAME_LIB_FLAGS) $(BOOSTLDFLAGS) $(XMLLDFLAGS) $(READLINELDFLAGS)
+GAMELDFLAGS  := $(GAME_LIB_FLAGS) $(BOOSTLDFLAGS) $(XMLLDFLAGS) $(READLINELDFLAGS) $(THREADLDFLAGS)
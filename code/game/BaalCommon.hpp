@@ -195,6 +195,46 @@ std::ostream& operator<<(std::ostream& out, const Location& location)
   return out << location.row << ',' << location.col;
 }
 
+//
+// Span
+//
+
+/**
+ * A non-owning view of a contiguous run of T, e.g. all or part of a vector.
+ * The viewed storage must outlive the span.
+ */
+template <typename T>
+class Span
+{
+ public:
+  typedef T* iterator;
+
+  Span() : m_begin(nullptr), m_end(nullptr) {}
+
+  Span(T* begin, T* end) : m_begin(begin), m_end(end) {}
+
+  template <class Container>
+  Span(Container& container)
+    : m_begin(container.data()), m_end(container.data() + container.size())
+  {}
+
+  T* begin() const { return m_begin; }
+
+  T* end() const { return m_end; }
+
+  T* data() const { return m_begin; }
+
+  std::size_t size() const { return m_end - m_begin; }
+
+  bool empty() const { return m_begin == m_end; }
+
+  T& operator[](std::size_t i) const { return m_begin[i]; }
+
+ private:
+  T* m_begin;
+  T* m_end;
+};
+
 //
 // Misc free functions
 //
@@ -18,8 +18,15 @@ ProgramError::ProgramError(const std::string& expr,
   : m_expr(expr),
     m_file(file),
     m_line(line),
-    m_message(message)
+    m_message(message),
+    m_what()
 {
+  std::ostringstream out;
+  out << "Error at " << m_file << ":" << m_line << "\n"
+      << "Expression: " << m_expr << " FAILED\n"
+      << "Message: " << m_message << std::endl;
+  m_what = out.str();
+
 #ifndef WINDOWS
   if (attach) {
     std::cerr << what() << "\n\n"
@@ -34,14 +41,9 @@ ProgramError::ProgramError(const std::string& expr,
 const char* ProgramError::what() const throw()
 ///////////////////////////////////////////////////////////////////////////////
 {
-  static std::ostringstream out;
-  out.str("");
-  out.clear();
-
-  out << "Error at " << m_file << ":" << m_line << "\n"
-      << "Expression: " << m_expr << " FAILED\n"
-      << "Message: " << m_message << std::endl;
-  return out.str().c_str();
+  // Built once in the constructor; a shared buffer here would hand out
+  // dangling pointers and race when games run on several threads.
+  return m_what.c_str();
 }
 
 }
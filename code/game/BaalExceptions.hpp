@@ -39,6 +39,7 @@ class ProgramError : public std::exception
   std::string m_file;
   unsigned    m_line;
   std::string m_message;
+  std::string m_what;
 };
 
 //
@@ -94,4 +94,35 @@ unsigned fibonacci_div(float total, float base)
   }
 }
 
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t mix64(std::uint64_t x)
+///////////////////////////////////////////////////////////////////////////////
+{
+  // splitmix64 finalizer
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return x;
+}
+
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float counter_rand(std::uint64_t seed, std::uint64_t stream, std::uint64_t counter)
+///////////////////////////////////////////////////////////////////////////////
+{
+  const std::uint64_t golden = 0x9e3779b97f4a7c15ULL;
+
+  std::uint64_t x = mix64(seed + golden);
+  x = mix64(x ^ (stream * golden));
+  x = mix64(x ^ (counter + golden));
+
+  // Top 24 bits fill a float mantissa exactly
+  return float(x >> 40) / float(1u << 24);
+}
+
 } // namespace baal
@@ -2,6 +2,7 @@
 #define BaalMath_hpp
 
 #include <limits>
+#include <cstdint>
 
 namespace baal {
 
@@ -43,6 +44,13 @@ float sqrt(float value,
 
 unsigned fibonacci_div(float total, float base);
 
+/**
+ * Counter-based random numbers. Returns a uniform float in [0, 1) that is a
+ * pure function of its arguments, so independent streams (e.g. one per tile)
+ * can be drawn in any order, from any thread, with reproducible results.
+ */
+float counter_rand(std::uint64_t seed, std::uint64_t stream, std::uint64_t counter);
+
 }
 
 #endif
@@ -50,14 +50,21 @@ class City
 
   xmlNodePtr to_xml() const { return m_impl.to_xml(); }
 
+  void save(SnapshotWriter& out) const { m_impl.save(out); }
+
   //
   // Modification API
   //
 
   /**
-   * Tell this city that the turn is cycling
+   * The phases of a city's turn. The AI player runs work_tiles for every
+   * city, feeds them all in one batch with feed_cities, runs
+   * spend_production for every city, and finally settles; see
+   * PlayerAI::cycle_turn.
    */
-  void cycle_turn() { m_impl.cycle_turn(); }
+  void work_tiles() { m_impl.work_tiles(); }
+
+  void spend_production() { m_impl.spend_production(); }
 
   /**
    * Kill off some of this city's citizens
@@ -70,6 +77,16 @@ class City
    */
   void destroy_defense(unsigned levels) { m_impl.destroy_defense(levels); }
 
+  /**
+   * Found the city of the settler built this turn, if any
+   */
+  void settle() { m_impl.settle(); }
+
+  /**
+   * Restore the state written by save
+   */
+  void load(SnapshotReader& in) { m_impl.load(in); }
+
   //
   // ==== Class constants ====
   //
@@ -81,6 +98,10 @@ class City
   // ==== Private members ====
   //
  private:
+  friend class CityIndex; // keeps the city's slot in its columns
+
+  CitySlot& slot() { return m_impl.m_slot; }
+
   details::CityImpl m_impl;
 };
 
@@ -0,0 +1,69 @@
+#include "CityColumns.hpp"
+#include "BaalExceptions.hpp"
+
+namespace baal {
+
+///////////////////////////////////////////////////////////////////////////////
+CityColumns::CityColumns(unsigned size)
+///////////////////////////////////////////////////////////////////////////////
+  : m_population(size, 0),
+    m_rank(size, 0),
+    m_next_rank_pop(size, 0),
+    m_production(size, 0.0),
+    m_defense(size, 0),
+    m_famine(size, false),
+    m_food(size, 0.0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void CityColumns::resize(unsigned size)
+///////////////////////////////////////////////////////////////////////////////
+{
+  m_population.resize(size, 0);
+  m_rank.resize(size, 0);
+  m_next_rank_pop.resize(size, 0);
+  m_production.resize(size, 0.0);
+  m_defense.resize(size, 0);
+  m_famine.resize(size, false);
+  m_food.resize(size, 0.0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CityColumns::copy_slot(unsigned dst_idx, const CityColumns& src, unsigned src_idx)
+///////////////////////////////////////////////////////////////////////////////
+{
+  Require(dst_idx < size(), "Bad slot " << dst_idx);
+  Require(src_idx < src.size(), "Bad slot " << src_idx);
+
+  m_population[dst_idx]    = src.m_population[src_idx];
+  m_rank[dst_idx]          = src.m_rank[src_idx];
+  m_next_rank_pop[dst_idx] = src.m_next_rank_pop[src_idx];
+  m_production[dst_idx]    = src.m_production[src_idx];
+  m_defense[dst_idx]       = src.m_defense[src_idx];
+  m_famine[dst_idx]        = src.m_famine[src_idx];
+  m_food[dst_idx]          = src.m_food[src_idx];
+}
+
+/*****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////////
+CitySlot::CitySlot()
+///////////////////////////////////////////////////////////////////////////////
+  : m_own_columns(new CityColumns(1)),
+    m_columns(m_own_columns.get()),
+    m_index(0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void CitySlot::bind(CityColumns& columns, unsigned index)
+///////////////////////////////////////////////////////////////////////////////
+{
+  Require(m_own_columns != nullptr, "Slot was already bound");
+
+  columns.copy_slot(index, *m_columns, m_index);
+  m_columns = &columns;
+  m_index   = index;
+  m_own_columns.reset();
+}
+
+}
@@ -0,0 +1,80 @@
+#ifndef CityColumns_hpp
+#define CityColumns_hpp
+
+#include <vector>
+#include <memory>
+
+namespace baal {
+
+/**
+ * Structure-of-arrays storage for the numeric state of cities. The World's
+ * CityIndex owns one of these, parallel to its list of cities, so that
+ * per-turn passes over every city (growth, population totals) walk
+ * contiguous memory.
+ */
+struct CityColumns
+{
+  explicit CityColumns(unsigned size = 0);
+
+  CityColumns(const CityColumns&) = delete;
+  CityColumns& operator=(const CityColumns&) = delete;
+
+  unsigned size() const { return m_population.size(); }
+
+  void resize(unsigned size);
+
+  // Copy every field of src's slot src_idx into our slot dst_idx
+  void copy_slot(unsigned dst_idx, const CityColumns& src, unsigned src_idx);
+
+  std::vector<unsigned>      m_population;
+  std::vector<unsigned>      m_rank;
+  std::vector<unsigned>      m_next_rank_pop;
+  std::vector<float>         m_production;
+  std::vector<unsigned>      m_defense;
+  std::vector<unsigned char> m_famine; // bytes, not vector<bool>, so batches can be split across threads
+
+  // Food gathered this turn; input to the growth kernel
+  std::vector<float>         m_food;
+};
+
+/**
+ * A handle to one city's slot in a CityColumns.
+ *
+ * A freshly created slot owns a private one-slot CityColumns so that cities
+ * can exist outside a world; bind() moves the slot's values into the
+ * world's columns and drops the private storage.
+ */
+class CitySlot
+{
+ public:
+  CitySlot();
+
+  CitySlot(const CitySlot&) = delete;
+  CitySlot& operator=(const CitySlot&) = delete;
+
+  void bind(CityColumns& columns, unsigned index);
+
+  // The slot's values were moved to index of the same columns
+  void move_to(unsigned index) { m_index = index; }
+
+  CityColumns& columns() const { return *m_columns; }
+
+  unsigned index() const { return m_index; }
+
+  unsigned&      population()    const { return m_columns->m_population[m_index]; }
+  unsigned&      rank()          const { return m_columns->m_rank[m_index]; }
+  unsigned&      next_rank_pop() const { return m_columns->m_next_rank_pop[m_index]; }
+  float&         production()    const { return m_columns->m_production[m_index]; }
+  unsigned&      defense()       const { return m_columns->m_defense[m_index]; }
+  unsigned char& famine()        const { return m_columns->m_famine[m_index]; }
+  float&         food()          const { return m_columns->m_food[m_index]; }
+
+ private:
+  std::unique_ptr<CityColumns> m_own_columns;
+  CityColumns*                 m_columns;
+  unsigned                     m_index;
+};
+
+}
+
+#endif
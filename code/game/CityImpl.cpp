@@ -4,6 +4,7 @@
 #include "World.hpp"
 #include "Engine.hpp"
 #include "PlayerAI.hpp"
+#include "Snapshot.hpp"
 
 #include <cstdlib>
 #include <cmath>
@@ -69,14 +70,6 @@ struct FilterTooCloseToOtherCities
   const Engine& m_engine;
 };
 
-struct FilterAlreadyWorked
-{
-  bool operator()(const WorldTile& tile) const
-  {
-    return !tile.worked();
-  }
-};
-
 ///////////////////////////////////////////////////////////////////////////////
 std::ostream& operator<<(std::ostream& out, CityImpl::Action action)
 ///////////////////////////////////////////////////////////////////////////////
@@ -112,19 +105,63 @@ std::ostream& operator<<(std::ostream& out, CityImpl::Action action)
   return out;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void feed_cities(CityColumns& columns, unsigned begin, unsigned end)
+///////////////////////////////////////////////////////////////////////////////
+{
+  Require(begin <= end && end <= columns.size(), "Bad range " << begin << ", " << end);
+
+  // Local copies, so the loop body sees plain values rather than static
+  // members
+  const float    max_modifier = CityImpl::MAX_GROWTH_MODIFIER;
+  const float    growth_rate  = CityImpl::CITY_BASE_GROWTH_RATE;
+  const unsigned rank_up      = CityImpl::CITY_RANK_UP_MULTIPLIER;
+  const unsigned eats_one     = CityImpl::POP_THAT_EATS_ONE_FOOD;
+
+  unsigned*      population    = columns.m_population.data();
+  unsigned*      rank          = columns.m_rank.data();
+  unsigned*      next_rank_pop = columns.m_next_rank_pop.data();
+  unsigned char* famine        = columns.m_famine.data();
+  const float*   food          = columns.m_food.data();
+
+  // Same arithmetic as CityImpl::feed_people used to do one city at a time,
+  // with selects in place of branches so the compiler can vectorize it.
+  // Population must move with famine; that is checked once for the batch.
+  bool ok = true;
+  for (unsigned i = begin; i < end; ++i) {
+    const unsigned orig_pop = population[i];
+    const float    req_food = static_cast<float>(orig_pop) / eats_one;
+    const bool     starving = food[i] < req_food;
+
+    const float starve_mult = -req_food / food[i];
+    const float grow_mult   = food[i] / req_food;
+    const float multiplier  =
+      starving ? (starve_mult < -max_modifier ? -max_modifier : starve_mult)
+               : (grow_mult   >  max_modifier ?  max_modifier : grow_mult);
+
+    const unsigned new_pop = static_cast<unsigned>(orig_pop * (1 + (multiplier * growth_rate)));
+    const bool     ranked  = new_pop > next_rank_pop[i];
+
+    population[i]    = new_pop;
+    famine[i]        = starving;
+    rank[i]         += ranked;
+    next_rank_pop[i] *= ranked ? rank_up : 1;
+
+    ok &= starving ? (new_pop < orig_pop) : (new_pop > orig_pop);
+  }
+
+  // Invariants
+  Require(ok, "Population should decrease when there is famine and increase otherwise");
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 bool is_within_distance_of_any_city(Location location,
                                     int distance,
                                     const Engine& engine)
 ///////////////////////////////////////////////////////////////////////////////
 {
-  for (const City* city : engine.world().cities()) {
-    Location city_loc = city->location();
-    if (location.distance(city_loc) <= distance) {
-      return true;
-    }
-  }
-  return false;
+  return distance >= 0 &&
+    engine.world().city_index().any_within(location, distance);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -191,30 +228,89 @@ float compute_city_loc_heuristic(Location location, const Engine& engine)
   return available_food * available_prod;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void TileRanking::refresh(const Location& center, const World& world)
+///////////////////////////////////////////////////////////////////////////////
+{
+  // A city's neighbourhood never changes, so collect it once. Chunks within
+  // World::CITY_ACTIVE_RADIUS of a city are never asleep, and that covers
+  // the neighbourhood (see the static_asserts in PlayerAI::color_cities),
+  // so holding the tiles directly is safe.
+  if (m_entries.empty()) {
+    for (Location location : world.valid_nearby_tile_range(center)) {
+      if (location != center) {
+        WorldTile& tile = const_cast<WorldTile&>(world.get_tile(location));
+        m_entries.push_back(Entry{&tile, 0.0, false, unsigned(m_entries.size()),
+                                  tile.yield_version() - 1});
+      }
+    }
+  }
+
+  // Pull out the entries whose yield moved; the rest keep their order
+  m_rekeyed.clear();
+  auto kept = m_entries.begin();
+  for (Entry& entry : m_entries) {
+    const unsigned version = entry.m_tile->yield_version();
+    if (version != entry.m_version) {
+      const Yield yield = entry.m_tile->yield();
+      entry.m_food    = yield.m_food > 0;
+      entry.m_key     = entry.m_food ? yield.m_food : yield.m_prod;
+      entry.m_version = version;
+      m_rekeyed.push_back(entry);
+    }
+    else {
+      *kept++ = entry;
+    }
+  }
+
+  if (!m_rekeyed.empty()) {
+    std::sort(m_rekeyed.begin(), m_rekeyed.end(), before);
+    const auto middle = std::copy(m_rekeyed.begin(), m_rekeyed.end(), kept);
+    std::inplace_merge(m_entries.begin(), kept, middle, before);
+  }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 CityImpl::CityImpl(const std::string& name, Location location, Engine& engine)
 ///////////////////////////////////////////////////////////////////////////////
   : m_name(name),
-    m_rank(1),
-    m_population(CITY_STARTING_POP),
-    m_next_rank_pop(CITY_STARTING_POP * CITY_RANK_UP_MULTIPLIER),
-    m_production(0.0),
+    m_slot(),
     m_location(location),
-    m_defense_level(CITY_STARTING_DEFENSE),
-    m_famine(false),
-    m_engine(engine)
-{}
+    m_settler_site(),
+    m_engine(engine),
+    m_ranking(),
+    m_tiles(),
+    m_work_tiles(),
+    m_prod_gathered(0.0)
+{
+  m_slot.rank()          = 1;
+  m_slot.population()    = CITY_STARTING_POP;
+  m_slot.next_rank_pop() = CITY_STARTING_POP * CITY_RANK_UP_MULTIPLIER;
+  m_slot.production()    = 0.0;
+  m_slot.defense()       = CITY_STARTING_DEFENSE;
+  m_slot.famine()        = false;
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 CityImpl::tile_vec_pair
 CityImpl::examine_workable_tiles() const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  return compute_nearby_food_and_prod_tiles(
-    m_location,
-    m_engine.world().valid_nearby_tile_range(m_location),
-    m_engine,
-    FilterAlreadyWorked());
+  // Only unworked tiles are candidates; the ranking itself does not change
+  // when tiles are worked, so worked tiles are just skipped here
+  m_ranking.refresh(m_location, m_engine.world());
+
+  std::vector<WorldTile*> food_tiles, prod_tiles;
+  food_tiles.reserve(m_ranking.entries().size());
+  prod_tiles.reserve(m_ranking.entries().size());
+
+  for (const TileRanking::Entry& entry : m_ranking.entries()) {
+    if (!entry.m_tile->worked()) {
+      (entry.m_food ? food_tiles : prod_tiles).push_back(entry.m_tile);
+    }
+  }
+
+  return std::make_pair(food_tiles, prod_tiles);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -235,7 +331,7 @@ CityImpl::get_citizen_recommendation(const std::vector<WorldTile*>& food_tiles,
 
   float req_food = get_required_food();
   float food_gathered = FOOD_FROM_CITY_CENTER;
-  unsigned num_citizens_left = m_rank;
+  unsigned num_citizens_left = m_slot.rank();
 
   // Determine how many workers should be allocated to gathering food. This
   // has the highest priority up until the minimum food is collected to
@@ -308,13 +404,13 @@ CityImpl::assign_citizens(const std::vector<WorldTile*>& work_food_tiles,
 
   // Remaining workers are specialists that contribute production
   const unsigned num_specialists =
-    m_rank - work_food_tiles.size() - work_prod_tiles.size();
+    m_slot.rank() - work_food_tiles.size() - work_prod_tiles.size();
   prod_gathered += num_specialists * PROD_FROM_SPECIALIST;
 
   // AI get's a resource collection bonus from tech
   food_gathered = ai.get_adjusted_yield(food_gathered);
   prod_gathered = ai.get_adjusted_yield(prod_gathered);
-  m_production  += prod_gathered; // prod is accumulated, all food is eaten
+  m_slot.production() += prod_gathered; // prod is accumulated, all food is eaten
 #ifdef TRACE_CITY_AI
   std::cout << "    Collected a total of " << food_gathered << " food and "
             << prod_gathered << " production." << std::endl;
@@ -323,8 +419,8 @@ CityImpl::assign_citizens(const std::vector<WorldTile*>& work_food_tiles,
   // Invariants
   Require(food_gathered > 0.0, "Negative food gathered");
   Require(prod_gathered > 0.0, "Negative prod gathered");
-  Require(num_specialists <= m_rank, "Too many specialists");
-  Require(work_food_tiles.size() + work_prod_tiles.size() <= m_rank,
+  Require(num_specialists <= m_slot.rank(), "Too many specialists");
+  Require(work_food_tiles.size() + work_prod_tiles.size() <= m_slot.rank(),
           "Too many citizens allocated");
 
   return std::make_pair(food_gathered, prod_gathered);
@@ -337,49 +433,13 @@ void CityImpl::feed_people(float food)
 #ifdef TRACE_CITY_AI
   std::cout << "  feed_people(" << food << "):" << std::endl;
 #endif
-  unsigned orig_population = m_population;
-
-  // Compute population multiplier, cannot exceed base by more than a factor of 4
-  float food_multiplier = 1.0, req_food = get_required_food();
-  if (food < req_food) {
-    m_famine = true;
-    food_multiplier = -req_food / food;
-    if (food_multiplier < -1 * MAX_GROWTH_MODIFIER) {
-      food_multiplier = -1 * MAX_GROWTH_MODIFIER;
-    }
-  }
-  else {
-    m_famine = false;
-    food_multiplier = food / req_food;
-    if (food_multiplier > MAX_GROWTH_MODIFIER) {
-      food_multiplier = MAX_GROWTH_MODIFIER;
-    }
-  }
+  m_slot.food() = food;
+  feed_cities(m_slot.columns(), m_slot.index(), m_slot.index() + 1);
 
-  // Grow city
-  float pop_growth_rate = 1 + (food_multiplier * CITY_BASE_GROWTH_RATE);
 #ifdef TRACE_CITY_AI
-  std::cout << "    growth rate is " << pop_growth_rate << std::endl;
+  std::cout << "    pop is " << m_slot.population()
+            << ", rank is " << m_slot.rank() << std::endl;
 #endif
-  m_population *= pop_growth_rate;
-  if (m_population > m_next_rank_pop) {
-    ++m_rank;
-    m_next_rank_pop *= CITY_RANK_UP_MULTIPLIER;
-  }
-#ifdef TRACE_CITY_AI
-  std::cout << "    pop is " << m_population
-            << ", rank is " << m_rank << std::endl;
-#endif
-
-  // Invariants
-  if (m_famine) {
-    Require(orig_population > m_population,
-            "Population should decrease when there is famine");
-  }
-  else {
-    Require(orig_population < m_population,
-            "Population should increase when there is not famine");
-  }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -415,8 +475,8 @@ CityImpl::get_recommended_production(const std::vector<WorldTile*>& food_tiles,
   // that there are nearby food tiles that we can enhance.
   {
     float pct_workers_on_food =
-      static_cast<float>(worked_food_tiles.size()) / m_rank;
-    if (pct_workers_on_food > TOO_MANY_FOOD_WORKERS || m_famine) {
+      static_cast<float>(worked_food_tiles.size()) / m_slot.rank();
+    if (pct_workers_on_food > TOO_MANY_FOOD_WORKERS || m_slot.famine()) {
       for (WorldTile* tile : food_tiles) {
         FoodTile* food_tile = dynamic_cast<FoodTile*>(tile);
         if (food_tile != nullptr &&
@@ -449,7 +509,7 @@ CityImpl::get_recommended_production(const std::vector<WorldTile*>& food_tiles,
   {
     // Check if building a settler is appropriate. New cities must be
     // "adjacent" to the city that created the settler.
-    const int max_distance = 3;
+    const int max_distance = SETTLER_MAX_DISTANCE;
     const int min_distance = 2;
     float heuristic_of_best_loc_so_far = 0.0;
     Location settler_loc;
@@ -463,7 +523,14 @@ CityImpl::get_recommended_production(const std::vector<WorldTile*>& food_tiles,
             world.get_tile(loc_delta).supports_city() &&
             !is_within_distance_of_any_city(loc_delta, min_distance - 1, m_engine)) {
 
-          float heuristic = compute_city_loc_heuristic(loc_delta, m_engine);
+          // Scoring a site writes the world's site cache and catches up
+          // the tiles around it. Cities of one color run this
+          // concurrently, which is only safe because those tiles are
+          // within PlayerAI::CITY_TURN_REACH, so no other city of the
+          // color reaches them, and within World::CITY_ACTIVE_RADIUS, so
+          // their chunks are awake and catching up does nothing; see the
+          // static_asserts in PlayerAI::color_cities.
+          float heuristic = world.city_site_score(loc_delta);
           if (heuristic > heuristic_of_best_loc_so_far) {
             settler_loc = loc_delta;
             heuristic_of_best_loc_so_far = heuristic;
@@ -502,11 +569,10 @@ bool CityImpl::produce_item(Action action)
 {
 #ifdef TRACE_CITY_AI
   std::cout << "  produce_item(" << action << ")" << std::endl;
-  std::cout << "    production accumulated: " << m_production << std::endl;
+  std::cout << "    production accumulated: " << m_slot.production() << std::endl;
 #endif
-  World& world = m_engine.world();
   bool was_produced = false;
-  float orig_production = m_production;
+  float orig_production = m_slot.production();
 
   // Now we actually try to build stuff. The order in which we check the bools
   // defines the priorities of the items.
@@ -516,9 +582,9 @@ bool CityImpl::produce_item(Action action)
     was_produced = build_infra(*action.m_affected_tile);
     break;
   case BUILD_SETTLER:
-    if (m_production >= SETTLER_PROD_COST) {
-      world.place_city(action.m_location);
-      m_production -= SETTLER_PROD_COST;
+    if (m_slot.production() >= SETTLER_PROD_COST) {
+      m_settler_site = action.m_location;
+      m_slot.production() -= SETTLER_PROD_COST;
       was_produced = true;
     }
     else {
@@ -526,9 +592,9 @@ bool CityImpl::produce_item(Action action)
     }
     break;
   case BUILD_DEFENSE:
-    if (m_production >= (m_defense_level * CITY_DEF_PROD_COST)) {
-      m_production -= (m_defense_level * CITY_DEF_PROD_COST);
-      ++m_defense_level;
+    if (m_slot.production() >= (m_slot.defense() * CITY_DEF_PROD_COST)) {
+      m_slot.production() -= (m_slot.defense() * CITY_DEF_PROD_COST);
+      ++m_slot.defense();
       was_produced = true;
     }
     else {
@@ -542,64 +608,59 @@ bool CityImpl::produce_item(Action action)
 
 #ifdef TRACE_CITY_AI
   std::cout << "    item was " << (was_produced ? "" : " not ") << "produced" << std::endl;
-  std::cout << "    production remaining: " << m_production << std::endl;
+  std::cout << "    production remaining: " << m_slot.production() << std::endl;
 #endif
 
   // Invariants
   if (was_produced) {
-    Require(orig_production > m_production, "Production should have decreased");
+    Require(orig_production > m_slot.production(), "Production should have decreased");
   }
   else {
-    Require(orig_production == m_production, "Production should not have changed");
+    Require(orig_production == m_slot.production(), "Production should not have changed");
   }
-  Require(m_production >= 0.0, "Negative production");
+  Require(m_slot.production() >= 0.0, "Negative production");
 
   return was_produced;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void CityImpl::cycle_turn()
+void CityImpl::work_tiles()
 ///////////////////////////////////////////////////////////////////////////////
 {
 #ifdef TRACE_CITY_AI
   std::cout << "cycle_turn for city: " << name() << std::endl;
 #endif
-  Require(m_population > 0,
+  Require(m_slot.population() > 0,
           "This city has no people and should have been deleted");
 
   // 1)
   // Evaluate nearby tiles, put in to sorted lists (best-to-worst) for each
   // of the two yield types
-  auto tile_pair = examine_workable_tiles();
-  const std::vector<WorldTile*>& food_tiles = tile_pair.first;
-  const std::vector<WorldTile*>& prod_tiles = tile_pair.second;
+  m_tiles = examine_workable_tiles();
 
   // 2)
   // Get recommended citizen allocation
-  auto work_tile_pair = get_citizen_recommendation(food_tiles, prod_tiles);
-  const std::vector<WorldTile*>& work_food_tiles = work_tile_pair.first;
-  const std::vector<WorldTile*>& work_prod_tiles = work_tile_pair.second;
+  m_work_tiles = get_citizen_recommendation(m_tiles.first, m_tiles.second);
 
   // 3)
   // Assign citizens based on recommendations
-  auto resources_gathered = assign_citizens(work_food_tiles, work_prod_tiles);
-  const float food_gathered = resources_gathered.first;
-  const float prod_gathered = resources_gathered.second;
-
-  // 4)
-  // Feed people and grow population. Needs to happen *before* we decide
-  // on what to build so we can use information based on this harvest
-  // to help determine what to build.
-  feed_people(food_gathered);
+  auto resources_gathered = assign_citizens(m_work_tiles.first, m_work_tiles.second);
+  m_slot.food()   = resources_gathered.first;
+  m_prod_gathered = resources_gathered.second;
+}
 
+///////////////////////////////////////////////////////////////////////////////
+void CityImpl::spend_production()
+///////////////////////////////////////////////////////////////////////////////
+{
   // 5)
   // Decide on how to spend production.
-  Action recommended_build = get_recommended_production(food_tiles,
-                                                        prod_tiles,
-                                                        work_food_tiles,
-                                                        work_prod_tiles,
-                                                        food_gathered,
-                                                        prod_gathered);
+  Action recommended_build = get_recommended_production(m_tiles.first,
+                                                        m_tiles.second,
+                                                        m_work_tiles.first,
+                                                        m_work_tiles.second,
+                                                        m_slot.food(),
+                                                        m_prod_gathered);
 
   // 6)
   // Produce recommended item if possible
@@ -610,18 +671,40 @@ void CityImpl::cycle_turn()
 void CityImpl::kill(unsigned killed)
 ///////////////////////////////////////////////////////////////////////////////
 {
-  Require(m_population >= killed, "Invalid killed: " << killed);
+  Require(m_slot.population() >= killed, "Invalid killed: " << killed);
 
-  m_population -= killed;
+  m_slot.population() -= killed;
 
-  if (m_population > 0) {
-    while (m_population < m_next_rank_pop / CITY_RANK_UP_MULTIPLIER) {
-      --m_rank;
-      m_next_rank_pop /= CITY_RANK_UP_MULTIPLIER;
+  if (m_slot.population() > 0) {
+    // Rank never drops below the rank cities are founded at
+    while (m_slot.rank() > 1 &&
+           m_slot.population() < m_slot.next_rank_pop() / CITY_RANK_UP_MULTIPLIER) {
+      --m_slot.rank();
+      m_slot.next_rank_pop() /= CITY_RANK_UP_MULTIPLIER;
     }
   }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void CityImpl::settle()
+///////////////////////////////////////////////////////////////////////////////
+{
+  if (!is_valid(m_settler_site)) {
+    return;
+  }
+
+  // Same rule the site was chosen by in get_recommended_production
+  World& world = m_engine.world();
+  if (world.get_tile(m_settler_site).supports_city() &&
+      !is_within_distance_of_any_city(m_settler_site, 1, m_engine)) {
+    world.place_city(m_settler_site);
+  }
+  else {
+    m_slot.production() += SETTLER_PROD_COST;
+  }
+  m_settler_site = Location();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 bool CityImpl::build_infra(LandTile& land_tile)
 ///////////////////////////////////////////////////////////////////////////////
@@ -630,8 +713,8 @@ bool CityImpl::build_infra(LandTile& land_tile)
   Require(infra_level < LandTile::LAND_TILE_MAX_INFRA, "Error in build eval");
   unsigned next_infra_level = infra_level + 1;
   float prod_cost = next_infra_level * INFRA_PROD_COST;
-  if (prod_cost <= m_production) {
-    m_production -= prod_cost;
+  if (prod_cost <= m_slot.production()) {
+    m_slot.production() -= prod_cost;
     land_tile.build_infra();
     return true;
   }
@@ -644,7 +727,7 @@ void CityImpl::destroy_defense(unsigned levels)
 {
   Require(defense() >= levels, "Invalid destroy levels: " << levels);
 
-  m_defense_level -= levels;
+  m_slot.defense() -= levels;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -654,19 +737,19 @@ xmlNodePtr CityImpl::to_xml() const
   xmlNodePtr City_node = xmlNewNode(nullptr, BAD_CAST "City");
 
   std::ostringstream rank_oss;
-  rank_oss << m_rank;
+  rank_oss << m_slot.rank();
   xmlNewChild(City_node, nullptr, BAD_CAST "m_rank", BAD_CAST rank_oss.str().c_str());
 
   std::ostringstream population_oss;
-  population_oss << m_population;
+  population_oss << m_slot.population();
   xmlNewChild(City_node, nullptr, BAD_CAST "m_population", BAD_CAST population_oss.str().c_str());
 
   std::ostringstream next_rank_pop_oss;
-  next_rank_pop_oss << m_next_rank_pop;
+  next_rank_pop_oss << m_slot.next_rank_pop();
   xmlNewChild(City_node, nullptr, BAD_CAST "m_next_rank_pop", BAD_CAST next_rank_pop_oss.str().c_str());
 
   std::ostringstream production_oss;
-  production_oss << m_production;
+  production_oss << m_slot.production();
   xmlNewChild(City_node, nullptr, BAD_CAST "m_production", BAD_CAST production_oss.str().c_str());
 
   std::ostringstream location_oss;
@@ -674,15 +757,55 @@ xmlNodePtr CityImpl::to_xml() const
   xmlNewChild(City_node, nullptr, BAD_CAST "m_location", BAD_CAST location_oss.str().c_str());
 
   std::ostringstream defense_level_rank_oss;
-  defense_level_rank_oss << m_defense_level;
+  defense_level_rank_oss << m_slot.defense();
   xmlNewChild(City_node, nullptr, BAD_CAST "m_defense_level", BAD_CAST defense_level_rank_oss.str().c_str());
 
   std::ostringstream famine_oss;
-  famine_oss << m_famine;
+  famine_oss << famine();
   xmlNewChild(City_node, nullptr, BAD_CAST "m_famine", BAD_CAST famine_oss.str().c_str());
 
   return City_node;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void CityImpl::save(SnapshotWriter& out) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  out.write(m_slot.rank());
+  out.write(m_slot.population());
+  out.write(m_slot.next_rank_pop());
+  out.write(m_slot.production());
+  out.write(m_slot.defense());
+  out.write(famine());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CityImpl::load(SnapshotReader& in)
+///////////////////////////////////////////////////////////////////////////////
+{
+  const unsigned rank          = in.read<unsigned>();
+  const unsigned population    = in.read<unsigned>();
+  const unsigned next_rank_pop = in.read<unsigned>();
+
+  RequireUser(rank > 0, "Corrupt snapshot, bad city rank " << rank);
+  RequireUser(population > 0, "Corrupt snapshot, city has no population");
+
+  // Cities start at rank 1 and next_rank_pop moves with every rank change
+  std::uint64_t expected_next_rank_pop = CITY_STARTING_POP;
+  for (unsigned r = 0; r < rank && expected_next_rank_pop <= next_rank_pop; ++r) {
+    expected_next_rank_pop *= CITY_RANK_UP_MULTIPLIER;
+  }
+  RequireUser(next_rank_pop == expected_next_rank_pop && population <= next_rank_pop,
+              "Corrupt snapshot, city of rank " << rank << " with population " << population <<
+              " cannot rank up at " << next_rank_pop);
+
+  m_slot.rank()          = rank;
+  m_slot.population()    = population;
+  m_slot.next_rank_pop() = next_rank_pop;
+  m_slot.production()    = in.read<float>();
+  m_slot.defense()       = in.read<unsigned>();
+  m_slot.famine()        = in.read<bool>();
+}
+
 }
 }
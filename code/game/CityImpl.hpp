@@ -2,8 +2,10 @@
 #define CityImpl_hpp
 
 #include "BaalCommon.hpp"
+#include "CityColumns.hpp"
 
 #include <string>
+#include <vector>
 
 #include <libxml/parser.h>
 
@@ -11,10 +13,65 @@ namespace baal {
 
 class LandTile;
 class WorldTile;
+class World;
 class Engine;
+class SnapshotWriter;
+class SnapshotReader;
 
 namespace details { // Clients, stay away!
 
+/**
+ * The tiles around a city, kept ranked best-to-worst across turns: food
+ * tiles by food, then the rest by production.
+ *
+ * Each entry remembers the yield version its key was taken at. refresh()
+ * re-keys only the tiles whose version moved, sorts just those, and merges
+ * them back into the entries that kept their place, so a turn costs
+ * O(n + k log k) for k re-keyed tiles and a quiet neighbourhood costs one
+ * pass of version compares.
+ *
+ * The whole neighbourhood stays ordered rather than only the best rank()
+ * tiles: examine_workable_tiles hands out complete best-to-worst lists, and
+ * get_recommended_production walks past the worked tiles to find the best
+ * tile that can still take infrastructure.
+ */
+class TileRanking
+{
+ public:
+  struct Entry
+  {
+    WorldTile* m_tile;
+    float      m_key;     // food for food tiles, production otherwise
+    bool       m_food;
+    unsigned   m_order;   // position in the neighbourhood; breaks ties
+    unsigned   m_version; // tile's yield version when m_key was taken
+  };
+
+  TileRanking() : m_entries(), m_rekeyed() {}
+
+  /**
+   * Bring the ranking up to date with the tiles around center
+   */
+  void refresh(const Location& center, const World& world);
+
+  const std::vector<Entry>& entries() const { return m_entries; }
+
+ private:
+  static bool before(const Entry& lhs, const Entry& rhs)
+  {
+    if (lhs.m_food != rhs.m_food) {
+      return lhs.m_food;
+    }
+    if (lhs.m_key != rhs.m_key) {
+      return lhs.m_key > rhs.m_key;
+    }
+    return lhs.m_order < rhs.m_order;
+  }
+
+  std::vector<Entry> m_entries;
+  std::vector<Entry> m_rekeyed; // scratch for refresh
+};
+
 /**
  * Implementation for City class. Nothing is private in this class
  * in order to make unit-testing easier.
@@ -39,26 +96,38 @@ class CityImpl
 
   const std::string& name() const { return m_name; }
 
-  unsigned population() const { return m_population; }
+  unsigned population() const { return m_slot.population(); }
 
-  unsigned rank() const { return m_rank; }
+  unsigned rank() const { return m_slot.rank(); }
 
   Location location() const { return m_location; }
 
-  bool famine() const { return m_famine; }
+  bool famine() const { return m_slot.famine(); }
 
-  unsigned defense() const { return m_defense_level; }
+  unsigned defense() const { return m_slot.defense(); }
 
   xmlNodePtr to_xml() const;
 
+  // Name and location are saved by the World, which needs them to
+  // recreate the city before loading the rest
+  void save(SnapshotWriter& out) const;
+
+  void load(SnapshotReader& in);
+
   //
   // Modification API
   //
 
   /**
-   * Tell this city that the turn is cycling
+   * First phase of a turn: pick and work tiles. The food gathered is left
+   * in the city's slot for feed_cities.
+   */
+  void work_tiles();
+
+  /**
+   * Last phase of a turn: decide what to build and try to build it.
    */
-  void cycle_turn();
+  void spend_production();
 
   /**
    * Kill off some of this city's citizens
@@ -71,6 +140,12 @@ class CityImpl
    */
   void destroy_defense(unsigned levels);
 
+  /**
+   * Found the city of the settler built this turn, if any. If the site
+   * has been taken or crowded since, the settler's production is refunded.
+   */
+  void settle();
+
   //
   // ==== Internal types and methods ====
   //
@@ -128,14 +203,16 @@ class CityImpl
 
   /**
    * Give the people food. The population will change based on how much food
-   * was provided.
+   * was provided. Runs feed_cities on this city's slot alone.
    */
   void feed_people(float food);
 
   /**
    * Try to build something.
    *
-   * Returns true if the item was built.
+   * Returns true if the item was built. Settlers do not found their city
+   * here: cities take their turns concurrently, so the new city is placed
+   * afterwards by the AI player (see settle).
    */
   bool produce_item(Action action);
 
@@ -178,7 +255,7 @@ class CityImpl
    */
   float get_required_food() const
   {
-    return static_cast<float>(m_population) / POP_THAT_EATS_ONE_FOOD;
+    return static_cast<float>(m_slot.population()) / POP_THAT_EATS_ONE_FOOD;
   }
 
   //
@@ -186,15 +263,19 @@ class CityImpl
   //
 
   std::string m_name;
-  unsigned    m_rank;
-  unsigned    m_population;
-  unsigned    m_next_rank_pop;
-  float       m_production;
+  CitySlot    m_slot; // rank, population, production, ...; see CityColumns
   Location    m_location;
-  unsigned    m_defense_level;
-  bool        m_famine;
+  Location    m_settler_site; // pending, see settle
   Engine&     m_engine;
 
+  // Cache behind examine_workable_tiles
+  mutable TileRanking m_ranking;
+
+  // Carried from work_tiles to spend_production; food is in m_slot
+  tile_vec_pair m_tiles;
+  tile_vec_pair m_work_tiles;
+  float         m_prod_gathered;
+
   //
   // ==== Class constants ====
   //
@@ -218,6 +299,9 @@ class CityImpl
   // AI constants
   static constexpr float TOO_MANY_FOOD_WORKERS = 0.66;
   static constexpr float PROD_BEFORE_SETTLER   = 7.0;
+
+  // Farthest from a city that its settlers may found a new one
+  static constexpr unsigned SETTLER_MAX_DISTANCE = 3;
 };
 
 //
@@ -231,6 +315,12 @@ bool is_within_distance_of_any_city(Location location,
 
 float compute_city_loc_heuristic(Location location, const Engine& engine);
 
+/**
+ * Grow the cities in slots [begin, end) of columns from the food left in
+ * their slots: the batched form of CityImpl::feed_people.
+ */
+void feed_cities(CityColumns& columns, unsigned begin, unsigned end);
+
 }
 }
 
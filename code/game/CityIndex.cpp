@@ -0,0 +1,80 @@
+#include "CityIndex.hpp"
+#include "City.hpp"
+
+namespace baal {
+
+constexpr unsigned CityIndex::CELL_SIZE;
+
+///////////////////////////////////////////////////////////////////////////////
+CityIndex::CityIndex(unsigned width, unsigned height)
+///////////////////////////////////////////////////////////////////////////////
+  : m_width(width),
+    m_height(height),
+    m_cell_rows((height + CELL_SIZE - 1) / CELL_SIZE),
+    m_cell_cols((width  + CELL_SIZE - 1) / CELL_SIZE),
+    m_cities(),
+    m_locations(),
+    m_cells(m_cell_rows * m_cell_cols),
+    m_columns()
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void CityIndex::insert(City& city)
+///////////////////////////////////////////////////////////////////////////////
+{
+  const Location location = city.location();
+  Require(location.row < m_height && location.col < m_width, "Out of bounds");
+  Require(find(location) == nullptr, "Already a city at " << location);
+
+  m_cells[cell_of(location)].push_back(m_cities.size());
+  m_cities.push_back(&city);
+  m_locations.push_back(location);
+  m_columns.resize(m_cities.size());
+  city.slot().bind(m_columns, m_cities.size() - 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CityIndex::remove(City& city)
+///////////////////////////////////////////////////////////////////////////////
+{
+  // Cells hold at most CELL_SIZE^2 cities, so the searches below are
+  // bounded no matter how many cities there are
+
+  const Location location = city.location();
+  Require(location.row < m_height && location.col < m_width, "Out of bounds");
+
+  std::vector<unsigned>& cell = m_cells[cell_of(location)];
+  auto itr = std::find_if(cell.begin(), cell.end(),
+                          [this, &city](unsigned position) { return m_cities[position] == &city; });
+  Require(itr != cell.end(), "City '" << city.name() << "' not in index");
+
+  const unsigned position = *itr;
+  *itr = cell.back();
+  cell.pop_back();
+
+  // Move the last city into the hole, and repoint its cell entry
+  const unsigned last = m_cities.size() - 1;
+  if (position != last) {
+    std::vector<unsigned>& last_cell = m_cells[cell_of(m_locations[last])];
+    *std::find(last_cell.begin(), last_cell.end(), last) = position;
+
+    m_cities[position]    = m_cities[last];
+    m_locations[position] = m_locations[last];
+    m_columns.copy_slot(position, m_columns, last);
+    m_cities[position]->slot().move_to(position);
+  }
+  m_cities.pop_back();
+  m_locations.pop_back();
+  m_columns.resize(m_cities.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+City* CityIndex::find(const Location& location) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  City* rv = nullptr;
+  visit_within(location, 0, [&rv](City& city) -> bool { rv = &city; return false; });
+  return rv;
+}
+
+}
@@ -0,0 +1,118 @@
+#ifndef CityIndex_hpp
+#define CityIndex_hpp
+
+#include "BaalCommon.hpp"
+#include "BaalExceptions.hpp"
+#include "CityColumns.hpp"
+
+#include <vector>
+#include <algorithm>
+
+namespace baal {
+
+class City;
+
+/**
+ * The cities of a world, both as a flat list and bucketed by location.
+ *
+ * The map is divided into CELL_SIZE x CELL_SIZE cells; each cell lists the
+ * cities inside it, as positions in the flat list. Radius queries only visit
+ * the cells overlapping the query square, and removal swaps the last city
+ * into the removed city's place, so neither depends on the number of
+ * cities. Removal therefore does not preserve the order of cities().
+ *
+ * The index also owns the cities' numeric state, as CityColumns parallel
+ * to cities(): inserting a city binds its slot there, and removal moves
+ * the last city's slot along with it.
+ */
+class CityIndex
+{
+ public:
+  CityIndex(unsigned width, unsigned height);
+
+  CityIndex(const CityIndex&) = delete;
+  CityIndex& operator=(const CityIndex&) = delete;
+
+  const std::vector<City*>& cities() const { return m_cities; }
+
+  /**
+   * Slot i of the columns belongs to cities()[i]
+   */
+  CityColumns& columns() const { return m_columns; }
+
+  void insert(City& city);
+
+  void remove(City& city);
+
+  /**
+   * Return the city at location, if any
+   */
+  City* find(const Location& location) const;
+
+  /**
+   * True if any city is within distance (see Location::distance)
+   */
+  bool any_within(const Location& location, unsigned distance) const
+  {
+    bool found = false;
+    visit_within(location, distance, [&found](City&) -> bool { found = true; return false; });
+    return found;
+  }
+
+  /**
+   * Call func(City&) for every city within distance of location, stopping
+   * early if func returns false.
+   */
+  template <class Func>
+  void visit_within(const Location& location, unsigned distance, Func func) const;
+
+  static constexpr unsigned CELL_SIZE = 8;
+
+ private:
+  unsigned cell_index(unsigned cell_row, unsigned cell_col) const
+  { return cell_row * m_cell_cols + cell_col; }
+
+  unsigned cell_of(const Location& location) const
+  { return cell_index(location.row / CELL_SIZE, location.col / CELL_SIZE); }
+
+  // Location of m_cities[position]; cached so queries do not have to go
+  // through City
+  const Location& location_of(unsigned position) const { return m_locations[position]; }
+
+  unsigned m_width;
+  unsigned m_height;
+  unsigned m_cell_rows;
+  unsigned m_cell_cols;
+  std::vector<City*>                 m_cities;
+  std::vector<Location>              m_locations; // parallel to m_cities
+  std::vector<std::vector<unsigned> > m_cells;    // positions in m_cities
+  mutable CityColumns                m_columns;  // parallel to m_cities
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <class Func>
+void CityIndex::visit_within(const Location& location, unsigned distance, Func func) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  Assert(location.row < m_height && location.col < m_width, "Out of bounds");
+
+  const unsigned row_begin = location.row - std::min(location.row, distance);
+  const unsigned col_begin = location.col - std::min(location.col, distance);
+  const unsigned row_last  = std::min(m_height - 1, location.row + distance);
+  const unsigned col_last  = std::min(m_width - 1,  location.col + distance);
+
+  for (unsigned cell_row = row_begin / CELL_SIZE; cell_row <= row_last / CELL_SIZE; ++cell_row) {
+    for (unsigned cell_col = col_begin / CELL_SIZE; cell_col <= col_last / CELL_SIZE; ++cell_col) {
+      for (unsigned position : m_cells[cell_index(cell_row, cell_col)]) {
+        if (location.distance(location_of(position)) <= distance &&
+            !func(*m_cities[position])) {
+          return;
+        }
+      }
+    }
+  }
+}
+
+}
+
+#endif
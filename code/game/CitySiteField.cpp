@@ -0,0 +1,76 @@
+#include "CitySiteField.hpp"
+#include "CityImpl.hpp"
+#include "TileColumns.hpp"
+#include "BaalExceptions.hpp"
+
+#include <algorithm>
+
+namespace baal {
+
+constexpr unsigned CitySiteField::SITE_RADIUS;
+constexpr unsigned CitySiteField::CITY_REACH;
+
+///////////////////////////////////////////////////////////////////////////////
+CitySiteField::CitySiteField(unsigned width, unsigned height)
+///////////////////////////////////////////////////////////////////////////////
+  : m_width(width),
+    m_height(height),
+    m_score(width * height, 0.0),
+    m_stamp(width * height, 0),
+    m_valid(width * height, false)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+float CitySiteField::score(const Location& location,
+                           const TileColumns& columns,
+                           const Engine& engine)
+///////////////////////////////////////////////////////////////////////////////
+{
+  Assert(location.row < m_height && location.col < m_width, "Out of bounds");
+
+  const unsigned idx = location.row * m_width + location.col;
+  const unsigned stamp = yield_stamp(location, columns);
+  if (!m_valid[idx] || m_stamp[idx] != stamp) {
+    m_score[idx] = details::compute_city_loc_heuristic(location, engine);
+    m_stamp[idx] = stamp;
+    m_valid[idx] = true;
+  }
+  return m_score[idx];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CitySiteField::invalidate_near_city(const Location& location)
+///////////////////////////////////////////////////////////////////////////////
+{
+  const unsigned row_begin = location.row - std::min(location.row, CITY_REACH);
+  const unsigned col_begin = location.col - std::min(location.col, CITY_REACH);
+  const unsigned row_end   = std::min(m_height, location.row + CITY_REACH + 1);
+  const unsigned col_end   = std::min(m_width,  location.col + CITY_REACH + 1);
+
+  for (unsigned row = row_begin; row < row_end; ++row) {
+    std::fill(m_valid.begin() + row * m_width + col_begin,
+              m_valid.begin() + row * m_width + col_end,
+              false);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned CitySiteField::yield_stamp(const Location& location,
+                                    const TileColumns& columns) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  const unsigned row_begin = location.row - std::min(location.row, SITE_RADIUS);
+  const unsigned col_begin = location.col - std::min(location.col, SITE_RADIUS);
+  const unsigned row_end   = std::min(m_height, location.row + SITE_RADIUS + 1);
+  const unsigned col_end   = std::min(m_width,  location.col + SITE_RADIUS + 1);
+
+  unsigned stamp = 0;
+  for (unsigned row = row_begin; row < row_end; ++row) {
+    for (unsigned col = col_begin; col < col_end; ++col) {
+      stamp += columns.m_yield_version[row * m_width + col];
+    }
+  }
+  return stamp;
+}
+
+}
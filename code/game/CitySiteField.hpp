@@ -0,0 +1,64 @@
+#ifndef CitySiteField_hpp
+#define CitySiteField_hpp
+
+#include "BaalCommon.hpp"
+
+#include <vector>
+
+namespace baal {
+
+class Engine;
+struct TileColumns;
+
+/**
+ * Caches the settler-site heuristic (details::compute_city_loc_heuristic)
+ * for every tile of a world.
+ *
+ * A site's score depends on the yields of the tiles around it and on which
+ * of those tiles are next to a city. Each cached score remembers the yield
+ * versions of the tiles it was computed from, so a yield change only forces
+ * the sites next to that tile to be recomputed. Placing or removing a city
+ * must be reported through invalidate_near_city.
+ */
+class CitySiteField
+{
+ public:
+  CitySiteField(unsigned width, unsigned height);
+
+  CitySiteField(const CitySiteField&) = delete;
+  CitySiteField& operator=(const CitySiteField&) = delete;
+
+  /**
+   * Return the site score of a location, recomputing it if it is stale
+   */
+  float score(const Location& location, const TileColumns& columns, const Engine& engine);
+
+  /**
+   * A city was placed or removed at location
+   */
+  void invalidate_near_city(const Location& location);
+
+  // Tiles around a site that feed into its score
+  static constexpr unsigned SITE_RADIUS = 1;
+
+  // Tiles next to a city do not count toward a site, so a city affects the
+  // score of every site within this distance
+  static constexpr unsigned CITY_REACH = SITE_RADIUS + 1;
+
+ private:
+  // Sum of the yield versions of the tiles a site depends on. Versions
+  // only ever increase, so the sum changes iff any of them did.
+  unsigned yield_stamp(const Location& location, const TileColumns& columns) const;
+
+  unsigned m_width;
+  unsigned m_height;
+  std::vector<float>    m_score;
+  std::vector<unsigned> m_stamp;
+  // Not vector<bool>: cities far enough apart score their sites
+  // concurrently, which needs each flag to be its own object
+  std::vector<unsigned char> m_valid;
+};
+
+}
+
+#endif
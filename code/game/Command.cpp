@@ -350,22 +350,7 @@ SaveCommand::SaveCommand(const vecstr_t& args, Engine& engine)
 void SaveCommand::apply() const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  // IN PROGRESS
-  World&  world  = m_engine.world();
-  Player& player = m_engine.player();
-  //PlayerAI& ai_player = m_engine.ai_player();
-
-  xmlDocPtr doc = nullptr;
-  xmlNodePtr root_node = nullptr;
-  doc = xmlNewDoc(BAD_CAST "1.0");
-  root_node = xmlNewNode(nullptr, BAD_CAST "baal_root");
-  xmlDocSetRootElement(doc, root_node);
-
-  xmlAddChild(root_node, world.to_xml());
-  xmlAddChild(root_node, player.to_xml());
-  //xmlAddChild(root_node, ai_player.to_xml());
-
-  xmlSaveFormatFileEnc(m_arg.c_str(), doc, "UTF-8", 1);
+  m_engine.save(m_arg);
 }
 
 /*****************************************************************************/
@@ -380,7 +365,7 @@ SpellCommand::SpellCommand(const vecstr_t& args, Engine& engine) :
               "'" << SpellCommand::NAME << "' takes two or three arguments");
 
   // Parse spell name
-  m_spell_name = args[0];
+  m_spell_id = SpellFactory::id_of(args[0]);
 
   // Parse location
   try {
@@ -398,7 +383,7 @@ SpellCommand::SpellCommand(const vecstr_t& args, Engine& engine) :
     RequireUser(!iss.fail(), "Third argument not a valid integer");
   }
   else {
-    m_spell_level = m_engine.player().talents().spell_skill(m_spell_name);
+    m_spell_level = m_engine.player().talents().spell_skill(m_spell_id);
   }
 }
 
@@ -418,7 +403,7 @@ void SpellCommand::apply() const
   // Create the spell. I'd rather use a reference here since spell
   // cannot be nullptr, but we need to use a shared-ptr since verify_cast can
   // throw exceptions.
-  auto spell = SpellFactory::create_spell(m_spell_name,
+  auto spell = SpellFactory::create_spell(m_spell_id,
                                           m_engine,
                                           m_spell_level,
                                           m_spell_location);
@@ -460,7 +445,7 @@ LearnCommand::LearnCommand(const vecstr_t& args, Engine& engine) :
               "'" << LearnCommand::NAME << "' takes one argument");
 
   // Parse spell name
-  m_spell_name = args[0];
+  m_spell_id = SpellFactory::id_of(args[0]);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -468,7 +453,7 @@ void LearnCommand::apply() const
 ///////////////////////////////////////////////////////////////////////////////
 {
   // Try to have the player learn this spell, this can throw
-  m_engine.player().learn(m_spell_name);
+  m_engine.player().learn(m_spell_id);
 }
 
 /*****************************************************************************/
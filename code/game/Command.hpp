@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "BaalCommon.hpp"
+#include "SpellFactory.hpp"
 
 // We use this file to define all the commands. This will avoid
 // creation of lots of very small hpp/cpp files.
@@ -133,7 +134,7 @@ class SpellCommand : public Command
 
   static const vecstr_t ALIASES;
  private:
-  std::string m_spell_name;
+  SpellId     m_spell_id;
   Location    m_spell_location;
   unsigned    m_spell_level;
 };
@@ -156,7 +157,7 @@ class LearnCommand : public Command
 
   static const vecstr_t ALIASES;
  private:
-  std::string m_spell_name;
+  SpellId     m_spell_id;
 };
 
 /**
@@ -24,22 +24,26 @@ class Configuration
    */
   Configuration(const std::string& interface_config = "",
                 const std::string& world_config     = "",
-                const std::string& player_config    = "")
+                const std::string& player_config    = "",
+                const std::string& threads_config   = "")
     : m_interface_config(interface_config),
       m_world_config    (world_config),
-      m_player_config   (player_config)
+      m_player_config   (player_config),
+      m_threads_config  (threads_config)
   {}
 
   Configuration(const Configuration& rhs)
     : m_interface_config(rhs.m_interface_config),
       m_world_config    (rhs.m_world_config),
-      m_player_config   (rhs.m_player_config)
+      m_player_config   (rhs.m_player_config),
+      m_threads_config  (rhs.m_threads_config)
   {}
 
   Configuration(Configuration&& rhs)
     : m_interface_config(std::move(rhs.m_interface_config)),
       m_world_config    (std::move(rhs.m_world_config)),
-      m_player_config   (std::move(rhs.m_player_config))
+      m_player_config   (std::move(rhs.m_player_config)),
+      m_threads_config  (std::move(rhs.m_threads_config))
   {}
 
   Configuration& operator=(Configuration&& rhs)
@@ -47,6 +51,7 @@ class Configuration
     m_interface_config = std::move(rhs.m_interface_config);
     m_world_config     = std::move(rhs.m_world_config);
     m_player_config    = std::move(rhs.m_player_config);
+    m_threads_config   = std::move(rhs.m_threads_config);
 
     return *this;
   }
@@ -62,12 +67,16 @@ class Configuration
   const std::string& get_player_config() const
   { return m_player_config; }
 
+  const std::string& get_threads_config() const
+  { return m_threads_config; }
+
  private:
 
   // Configuration items are all instance variables
   std::string m_interface_config;
   std::string m_world_config;
   std::string m_player_config;
+  std::string m_threads_config;
 };
 
 }
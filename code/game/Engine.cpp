@@ -6,6 +6,9 @@
 #include "Interface.hpp"
 #include "World.hpp"
 #include "Configuration.hpp"
+#include "Snapshot.hpp"
+
+#include <fstream>
 
 namespace baal {
 
@@ -57,30 +60,95 @@ void Engine::play()
 
     // Human player takes turn
     m_interface->interact();
-    m_player->cycle_turn();
-
-    // AI player takes turn
-    m_ai_player->cycle_turn();
 
-    // Cycle world. Note this should always be the last item to cycle.
-    m_world->cycle_turn();
+    // Everyone else takes turn
+    const GameState state = cycle_turn();
 
     // Check for game-ending state
-    if (m_ai_player->population() == 0) {
+    if (state == HUMAN_WON) {
       m_interface->human_wins();
       break;
     }
-    else if (m_ai_player->tech_level() >= AI_WINS_AT_TECH_LEVEL) {
+    else if (state == AI_WON) {
       m_interface->ai_wins();
       break;
     }
   }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+GameState Engine::cycle_turn()
+///////////////////////////////////////////////////////////////////////////////
+{
+  // Human player's per-turn upkeep (mana regen, etc)
+  m_player->cycle_turn();
+
+  // AI player takes turn
+  m_ai_player->cycle_turn();
+
+  // Cycle world. Note this should always be the last item to cycle.
+  m_world->cycle_turn();
+
+  // Check for game-ending state
+  if (m_ai_player->population() == 0) {
+    return HUMAN_WON;
+  }
+  else if (m_ai_player->tech_level() >= AI_WINS_AT_TECH_LEVEL) {
+    return AI_WON;
+  }
+  else {
+    return IN_PROGRESS;
+  }
+}
+
 void Engine::quit()
 {
   m_quit = true;
   m_interface->end_turn();
 }
 
+
+///////////////////////////////////////////////////////////////////////////////
+void Engine::save(const std::string& filename) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  std::ofstream file(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+  RequireUser(file.is_open(), "Could not open '" << filename << "' for writing");
+
+  SnapshotWriter out(file);
+  write_snapshot_header(out);
+  m_world->save(out);
+  m_player->save(out);
+  m_ai_player->save(out);
+
+  file.flush();
+  RequireUser(file.good(), "Failed to write '" << filename << "'");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Engine::load(const std::string& filename)
+///////////////////////////////////////////////////////////////////////////////
+{
+  std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
+  RequireUser(file.is_open(), "Could not open '" << filename << "' for reading");
+
+  // Build everything before touching our state so that a bad snapshot
+  // leaves the current game intact
+  SnapshotReader in(file);
+  read_snapshot_header(in);
+  std::shared_ptr<World>    world = World::load(in, *this);
+  std::shared_ptr<Player>   player(new Player(*this));
+  player->load(in);
+  std::shared_ptr<PlayerAI> ai_player(new PlayerAI(*this));
+  ai_player->load(in);
+
+  if (m_world) {
+    world->set_num_threads(m_world->num_threads());
+  }
+
+  m_world     = world;
+  m_player    = player;
+  m_ai_player = ai_player;
+}
+
 }
@@ -2,8 +2,15 @@
 #define Engine_hpp
 
 #include "Configuration.hpp"
+#include "BaalCommon.hpp"
 
 #include <memory>
+#include <string>
+
+SMART_ENUM(GameState,
+           IN_PROGRESS,
+           HUMAN_WON,
+           AI_WON);
 
 namespace baal {
 
@@ -31,6 +38,25 @@ class Engine
 
   void play();
 
+  /**
+   * Cycle everything except the interface by one turn: the human player,
+   * the AI player, and the world. Returns the state of the game afterwards.
+   * play() is built on this; headless drivers can call it directly.
+   */
+  GameState cycle_turn();
+
+  /**
+   * Write the full game state (world, cities, both players, time) to a
+   * binary snapshot file. See Snapshot.hpp for the format.
+   */
+  void save(const std::string& filename) const;
+
+  /**
+   * Replace the world and both players with the ones stored in a snapshot
+   * file written by save. The interface is kept.
+   */
+  void load(const std::string& filename);
+
   const Configuration& config() const { return m_config; }
 
   World& world() { return *m_world; }
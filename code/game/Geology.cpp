@@ -1,8 +1,11 @@
 #include "Geology.hpp"
 #include "BaalExceptions.hpp"
 #include "WorldTile.hpp"
+#include "Snapshot.hpp"
 
 #include <iomanip>
+#include <memory>
+#include <cmath>
 
 namespace baal {
 
@@ -11,11 +14,13 @@ Geology::Geology(float base_tension_buildup,
                  float base_magma_buildup,
                  float plate_movement)
 ///////////////////////////////////////////////////////////////////////////////
-  : m_tension(0.0),
+  : m_turn(0),
+    m_tension(0.0),
     m_magma(0.0),
     m_plate_movement(plate_movement),
     m_tension_buildup(base_tension_buildup * plate_movement),
-    m_magma_buildup(base_magma_buildup * plate_movement)
+    m_magma_buildup(base_magma_buildup * plate_movement),
+    m_shared(false)
 {
   Require(plate_movement >= 0.0,       "Broken precondition");
   Require(base_tension_buildup >= 0.0, "Broken precondition");
@@ -23,17 +28,30 @@ Geology::Geology(float base_tension_buildup,
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Geology::cycle_turn()
+void Geology::catch_up(unsigned turn)
 ///////////////////////////////////////////////////////////////////////////////
 {
-  // Tension/magma build up more slowly as they reach 100%
-  m_tension += (1 - m_tension) * m_tension_buildup;
-  m_magma   += (1 - m_magma)   * m_magma_buildup;
+  m_tension = tension(turn);
+  m_magma   = magma(turn);
+  m_turn    = turn;
 
   Require(m_tension < 1.0, "Invariant violated: " << m_tension);
   Require(m_magma   < 1.0, "Invariant violated: " << m_magma);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+float Geology::accumulate(float value, float buildup, unsigned turn) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  Require(turn >= m_turn, "Geology is ahead of turn " << turn << ": " << m_turn);
+
+  // Tension/magma build up more slowly as they reach 100%
+  if (buildup == 0.0 || turn == m_turn) {
+    return value;
+  }
+  return 1 - (1 - value) * std::pow(1.0 - buildup, turn - m_turn);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 bool Geology::is_geological(DrawMode mode)
 ///////////////////////////////////////////////////////////////////////////////
@@ -57,4 +75,49 @@ xmlNodePtr Geology::to_xml()
   return Geology_node;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void Geology::save(SnapshotWriter& out) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  out.write(std::string(geology_type()));
+  out.write(m_plate_movement);
+  out.write(m_turn);
+  out.write(m_tension);
+  out.write(m_magma);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Geology* Geology::load(SnapshotReader& in)
+///////////////////////////////////////////////////////////////////////////////
+{
+  const std::string type     = in.read_string();
+  const float plate_movement = in.read<float>();
+
+  std::unique_ptr<Geology> geology;
+  if (type == "Divergent") {
+    geology.reset(new Divergent(plate_movement));
+  }
+  else if (type == "Subducting") {
+    geology.reset(new Subducting(plate_movement));
+  }
+  else if (type == "Orogenic") {
+    geology.reset(new Orogenic(plate_movement));
+  }
+  else if (type == "Transform") {
+    geology.reset(new Transform(plate_movement));
+  }
+  else if (type == "Inactive") {
+    geology.reset(new Inactive);
+  }
+  else {
+    RequireUser(false, "Corrupt snapshot, unknown geology type " << type);
+  }
+
+  geology->m_turn    = in.read<unsigned>();
+  geology->m_tension = in.read<float>();
+  geology->m_magma   = in.read<float>();
+
+  return geology.release();
+}
+
 }
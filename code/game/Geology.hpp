@@ -15,6 +15,9 @@
 
 namespace baal {
 
+class SnapshotWriter;
+class SnapshotReader;
+
 /**
  * Contains geology (plate-tectonic) data.
  *
@@ -26,6 +29,11 @@ namespace baal {
  * Transform
  *
  * Every tile builds up plate tension and magma based on geology.
+ *
+ * Buildup is evaluated lazily. The stored tension and magma are as of
+ * the turn in turn(); since every turn applies x += (1 - x) * buildup, the
+ * value k turns later is 1 - (1 - x) * (1 - buildup)^k, so nothing needs to
+ * happen on turns where nobody looks.
  */
 class Geology
 {
@@ -36,11 +44,25 @@ class Geology
 
   virtual ~Geology() {}
 
-  void cycle_turn();
+  // Advance stored state by one turn
+  void cycle_turn() { catch_up(m_turn + 1); }
+
+  // Bring stored state up to date with turn
+  void catch_up(unsigned turn);
+
+  // Tension/magma as of turn, which must not precede turn()
+  float tension(unsigned turn) const { return accumulate(m_tension, m_tension_buildup, turn); }
+
+  float magma(unsigned turn) const { return accumulate(m_magma, m_magma_buildup, turn); }
+
+  // Tension/magma as of turn(), not as of the current turn; use the overloads
+  // above unless the stored state itself is what matters
+  float stored_tension() const { return m_tension; }
 
-  float tension() const { return m_tension; }
+  float stored_magma() const { return m_magma; }
 
-  float magma() const { return m_magma; }
+  // Turn the stored tension/magma are current as of
+  unsigned turn() const { return m_turn; }
 
   float plate_movement() const { return m_plate_movement; }
 
@@ -48,18 +70,33 @@ class Geology
 
   float magma_buildup() const { return m_magma_buildup; }
 
+  // Shared geologies belong to the World rather than to the tiles that
+  // refer to them; see World::share_geology
+  bool shared() const { return m_shared; }
+
   static bool is_geological(DrawMode mode);
 
   xmlNodePtr to_xml();
 
+  void save(SnapshotWriter& out) const;
+
+  // Caller owns the returned geology
+  static Geology* load(SnapshotReader& in);
+
  protected:
   virtual const char* geology_type() const = 0;
 
+  float accumulate(float value, float buildup, unsigned turn) const;
+
+  unsigned m_turn;
   float m_tension;
   float m_magma;
   float m_plate_movement;
   float m_tension_buildup;
   float m_magma_buildup;
+  bool  m_shared;
+
+  friend class World;
 };
 
 /**
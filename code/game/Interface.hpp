@@ -107,7 +107,7 @@ class Interface
 #define SPELL_REPORT(msg)                                               \
 do {                                                                    \
   std::ostringstream spell_report_oss;                                  \
-  spell_report_oss << m_name << ": " << msg;                            \
+  spell_report_oss << this->name() << ": " << msg;                      \
   m_engine.interface().spell_report(spell_report_oss.str());            \
 } while (false)
 
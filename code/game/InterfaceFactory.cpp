@@ -1,6 +1,7 @@
 #include "InterfaceFactory.hpp"
 #include "InterfaceText.hpp"
 #include "InterfaceGraphical.hpp"
+#include "InterfaceHeadless.hpp"
 #include "Configuration.hpp"
 #include "BaalExceptions.hpp"
 #include "BaalCommon.hpp"
@@ -16,6 +17,7 @@ namespace baal {
 
 const std::string InterfaceFactory::TEXT_INTERFACE          = "t";
 const std::string InterfaceFactory::GRAPHICAL_INTERFACE     = "g";
+const std::string InterfaceFactory::HEADLESS_INTERFACE      = "h";
 const std::string InterfaceFactory::DEFAULT_INTERFACE       = TEXT_INTERFACE;
 const std::string InterfaceFactory::SEPARATOR               = ":";
 const std::string InterfaceFactory::TEXT_WITH_COUT          = "cout";
@@ -67,6 +69,9 @@ std::shared_ptr<Interface> InterfaceFactory::create(Engine& engine)
   else if (tokens[0] == GRAPHICAL_INTERFACE) {
     return std::shared_ptr<Interface>(new InterfaceGraphical(engine));
   }
+  else if (tokens[0] == HEADLESS_INTERFACE) {
+    return std::shared_ptr<Interface>(new InterfaceHeadless());
+  }
   else {
     RequireUser(false, "Invalid choice of interface: " << interface_config);
   }
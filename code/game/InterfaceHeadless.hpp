@@ -0,0 +1,41 @@
+#ifndef InterfaceHeadless_hpp
+#define InterfaceHeadless_hpp
+
+#include "Interface.hpp"
+
+namespace baal {
+
+/**
+ * An interface that presents nothing and takes no input. Used for running
+ * AI-only simulations; the human player passes every turn.
+ */
+class InterfaceHeadless : public Interface
+{
+ public:
+  InterfaceHeadless() : Interface(0, 0) {}
+
+  virtual void draw() {}
+
+  virtual void draw(const Geology&) {}
+  virtual void draw(const Player&) {}
+  virtual void draw(const PlayerAI&) {}
+  virtual void draw(const Time&) {}
+  virtual void draw(const Atmosphere&) {}
+  virtual void draw(const Anomaly&) {}
+  virtual void draw(const World&) {}
+  virtual void draw(const WorldTile&) {}
+
+  virtual void interact() {}
+
+  virtual void help(const std::string& helpmsg) {}
+
+  virtual void spell_report(const std::string& report) {}
+
+  virtual void human_wins() {}
+
+  virtual void ai_wins() {}
+};
+
+}
+
+#endif
@@ -317,6 +317,7 @@ void InterfaceText::draw(const Geology& geology)
   std::string invalid_symbol = "????";
   std::string symbol = invalid_symbol;
   float property;
+  unsigned turn;
   std::ostringstream oss;
   auto draw_spec = get_draw_spec(geology);
 
@@ -327,7 +328,8 @@ void InterfaceText::draw(const Geology& geology)
     break;
   case TENSION:
   case MAGMA:
-    property = m_draw_mode == TENSION ? geology.tension() : geology.magma();
+    turn     = m_engine.world().time().turn();
+    property = m_draw_mode == TENSION ? geology.tension(turn) : geology.magma(turn);
     if (property < .333) {
       color = GREEN;
     }
@@ -497,8 +499,8 @@ void InterfaceText::draw(const World& world)
   m_draw_mode = real_draw_mode;
 
   // Draw recent anomalies
-  for (auto anomaly : world.anomalies()) {
-    draw(*anomaly);
+  for (const Anomaly& anomaly : world.anomalies()) {
+    draw(anomaly);
     print("\n");
   }
 }
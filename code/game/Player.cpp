@@ -3,6 +3,7 @@
 #include "Spell.hpp"
 #include "Configuration.hpp"
 #include "Engine.hpp"
+#include "Snapshot.hpp"
 
 #include <iostream>
 
@@ -33,6 +34,13 @@ void Player::learn(const std::string& spell_name)
   m_talents.add(spell_name);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void Player::learn(SpellId spell_id)
+///////////////////////////////////////////////////////////////////////////////
+{
+  m_talents.add(spell_id);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void Player::verify_cast(const Spell& spell) const
 ///////////////////////////////////////////////////////////////////////////////
@@ -122,4 +130,29 @@ xmlNodePtr Player::to_xml()
   return Player_node;
 }
 
+
+///////////////////////////////////////////////////////////////////////////////
+void Player::save(SnapshotWriter& out) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  out.write(m_name);
+  out.write(m_mana);
+  out.write(m_max_mana);
+  out.write(m_exp);
+  out.write(m_level);
+  m_talents.save(out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Player::load(SnapshotReader& in)
+///////////////////////////////////////////////////////////////////////////////
+{
+  m_name     = in.read_string();
+  m_mana     = in.read<unsigned>();
+  m_max_mana = in.read<unsigned>();
+  m_exp      = in.read<unsigned>();
+  m_level    = in.read<unsigned>();
+  m_talents.load(in);
+}
+
 }
@@ -11,6 +11,8 @@ namespace baal {
 
 class Spell;
 class Engine;
+class SnapshotWriter;
+class SnapshotReader;
 
 /**
  * Encapsulates player state.
@@ -26,6 +28,8 @@ class Player
   // player cannot learn the spell.
   void learn(const std::string& spell_name);
 
+  void learn(SpellId spell_id);
+
   // Check if this player can cast a spell. Throws a user error if the
   // answer is no.
   void verify_cast(const Spell& spell) const;
@@ -50,6 +54,10 @@ class Player
 
   xmlNodePtr to_xml();
 
+  void save(SnapshotWriter& out) const;
+
+  void load(SnapshotReader& in);
+
   const Engine& engine() const { return m_engine; }
 
   unsigned exp() const { return m_exp; }
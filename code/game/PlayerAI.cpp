@@ -2,16 +2,23 @@
 #include "Engine.hpp"
 #include "World.hpp"
 #include "City.hpp"
+#include "Snapshot.hpp"
+
+#include <unordered_map>
+#include <algorithm>
 
 namespace baal {
 
+constexpr unsigned PlayerAI::CITY_TURN_REACH;
+
 ///////////////////////////////////////////////////////////////////////////////
 PlayerAI::PlayerAI(const Engine& engine)
 ///////////////////////////////////////////////////////////////////////////////
   : m_tech_level(STARTING_TECH_LEVEL),
     m_tech_points(0),
     m_population(0),
-    m_engine(engine)
+    m_engine(engine),
+    m_city_colors()
 {}
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21,17 +28,46 @@ void PlayerAI::cycle_turn()
   const World& world = m_engine.world();
   const std::vector<City*>& cities = world.cities();
 
-  // Manage cities. Note that this may cause additional cities to be created,
-  // so we need to store the number of cities at the start of the cycle.
+  // Manage cities. Cities of one color are far enough apart that their
+  // turns touch disjoint tiles, so they run concurrently; colors run one
+  // after another in a fixed order, so tiles two cities could both work
+  // go to the earlier color whatever the number of threads. Growth only
+  // touches a city's own slot, so every city is fed in one batch over the
+  // city columns between working tiles and spending production. New
+  // cities are placed only once every city is done.
+  color_cities(cities);
+  for (const std::vector<City*>& color : m_city_colors) {
+    world.thread_pool().parallel_for(0, color.size(), [&color](unsigned begin, unsigned end) {
+      for (unsigned i = begin; i < end; ++i) {
+        color[i]->work_tiles();
+      }
+    });
+  }
+
+  CityColumns& columns = world.city_index().columns();
+  world.thread_pool().parallel_for(0, columns.size(), [&columns](unsigned begin, unsigned end) {
+    details::feed_cities(columns, begin, end);
+  });
+
+  for (const std::vector<City*>& color : m_city_colors) {
+    world.thread_pool().parallel_for(0, color.size(), [&color](unsigned begin, unsigned end) {
+      for (unsigned i = begin; i < end; ++i) {
+        color[i]->spend_production();
+      }
+    });
+  }
+
+  // Settlers found their cities in city order; a site an earlier settler
+  // took or crowded this turn is refused. This may cause additional cities
+  // to be created, so we need to store the number of cities first.
   for (unsigned i = 0, ie = cities.size(); i < ie; ++i) {
-    City* city = cities[i];
-    city->cycle_turn();
+    cities[i]->settle();
   }
 
   // Compute population
   m_population = 0;
-  for (const City* city : cities) {
-    m_population += city->population();
+  for (unsigned population : columns.m_population) {
+    m_population += population;
   }
 
   // Adjust tech based on population
@@ -49,6 +85,48 @@ void PlayerAI::cycle_turn()
           ") < tech-cost(" << next_tech_level_cost() << ")");
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void PlayerAI::color_cities(const std::vector<City*>& cities)
+///////////////////////////////////////////////////////////////////////////////
+{
+  // Greedy coloring in city order. Two cities conflict if the areas their
+  // turns reach overlap.
+  //
+  // Coloring makes concurrent turns race-free only if a turn stays within
+  // CITY_TURN_REACH, which must cover the worked tiles and every tile a
+  // settler site's score reads, and if all of those tiles are in chunks
+  // the World keeps awake, so that reading them never catches up.
+  static_assert(details::CityImpl::SETTLER_MAX_DISTANCE + CitySiteField::SITE_RADIUS <= CITY_TURN_REACH,
+                "A city's turn reads tiles beyond CITY_TURN_REACH");
+  static_assert(World::CITY_ACTIVE_RADIUS >= CITY_TURN_REACH,
+                "A city's turn reaches tiles in chunks that may be asleep");
+  const CityIndex& index = m_engine.world().city_index();
+  std::unordered_map<const City*, unsigned> color_of;
+  std::vector<bool> taken;
+
+  for (auto& color : m_city_colors) {
+    color.clear();
+  }
+
+  for (City* city : cities) {
+    taken.assign(m_city_colors.size() + 1, false);
+    index.visit_within(city->location(), 2 * CITY_TURN_REACH, [&](City& other) -> bool {
+      auto itr = color_of.find(&other);
+      if (itr != color_of.end()) {
+        taken[itr->second] = true;
+      }
+      return true;
+    });
+
+    const unsigned color = std::find(taken.begin(), taken.end(), false) - taken.begin();
+    if (color == m_city_colors.size()) {
+      m_city_colors.emplace_back();
+    }
+    m_city_colors[color].push_back(city);
+    color_of[city] = color;
+  }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 xmlNodePtr PlayerAI::to_xml()
 ///////////////////////////////////////////////////////////////////////////////
@@ -57,4 +135,23 @@ xmlNodePtr PlayerAI::to_xml()
   return PlayerAI_node;
 }
 
+
+///////////////////////////////////////////////////////////////////////////////
+void PlayerAI::save(SnapshotWriter& out) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  out.write(m_tech_level);
+  out.write(m_tech_points);
+  out.write(m_population);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void PlayerAI::load(SnapshotReader& in)
+///////////////////////////////////////////////////////////////////////////////
+{
+  m_tech_level  = in.read<unsigned>();
+  m_tech_points = in.read<unsigned>();
+  m_population  = in.read<unsigned>();
+}
+
 }
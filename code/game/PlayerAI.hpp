@@ -4,12 +4,15 @@
 #include "BaalMath.hpp"
 
 #include <cmath>
+#include <vector>
 #include <libxml/parser.h>
 
 namespace baal {
 
 class City;
 class Engine;
+class SnapshotWriter;
+class SnapshotReader;
 
 /**
  * Manages the "global" (higher-than-city) affairs of the AI. Since most
@@ -43,11 +46,23 @@ class PlayerAI
 
   xmlNodePtr to_xml();
 
+  void save(SnapshotWriter& out) const;
+
+  void load(SnapshotReader& in);
+
  private:
+  // Split cities into groups whose turns cannot touch the same tiles
+  void color_cities(const std::vector<City*>& cities);
+
   unsigned m_tech_level;
   unsigned m_tech_points;
   unsigned m_population;
   const Engine& m_engine;
+  std::vector<std::vector<City*> > m_city_colors; // scratch for cycle_turn
+
+  // Farthest from itself a city's turn reads or writes a tile: settler
+  // sites up to 3 away, and the tiles around those
+  static constexpr unsigned CITY_TURN_REACH = 4;
 
   static constexpr unsigned STARTING_TECH_LEVEL   = 1;
   static constexpr unsigned FIRST_TECH_LEVEL_COST = 1000;
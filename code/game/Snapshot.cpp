@@ -0,0 +1,170 @@
+#include "Snapshot.hpp"
+
+#include <iostream>
+#include <cstring>
+#include <limits>
+
+namespace baal {
+
+namespace {
+
+const char SNAPSHOT_MAGIC[8] = {'B', 'A', 'A', 'L', 'S', 'N', 'A', 'P'};
+
+// Written in native order; reads back differently on a foreign machine
+const std::uint32_t SNAPSHOT_ENDIAN_MARKER = 0x01020304;
+
+const unsigned SNAPSHOT_ALIGNMENT = 8;
+
+// Guards against allocating garbage lengths from a corrupt snapshot
+const std::uint32_t MAX_SNAPSHOT_STRING = 1 << 20;
+
+}
+
+///////////////////////////////////////////////////////////////////////////////
+SnapshotWriter::SnapshotWriter(std::ostream& out)
+///////////////////////////////////////////////////////////////////////////////
+  : m_out(out),
+    m_offset(0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void SnapshotWriter::write_bytes(const void* data, std::size_t num_bytes)
+///////////////////////////////////////////////////////////////////////////////
+{
+  m_out.write(static_cast<const char*>(data), num_bytes);
+  RequireUser(m_out.good(), "Failed to write snapshot");
+  m_offset += num_bytes;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SnapshotWriter::align()
+///////////////////////////////////////////////////////////////////////////////
+{
+  const char padding[SNAPSHOT_ALIGNMENT] = {0};
+  const unsigned remainder = m_offset % SNAPSHOT_ALIGNMENT;
+  if (remainder != 0) {
+    write_bytes(padding, SNAPSHOT_ALIGNMENT - remainder);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SnapshotWriter::write(const std::string& str)
+///////////////////////////////////////////////////////////////////////////////
+{
+  Require(str.size() <= MAX_SNAPSHOT_STRING, "String too long for snapshot: " << str.size());
+  write<std::uint32_t>(str.size());
+  write_bytes(str.data(), str.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SnapshotWriter::write(const Location& location)
+///////////////////////////////////////////////////////////////////////////////
+{
+  write(location.row);
+  write(location.col);
+}
+
+/*****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////////
+SnapshotReader::SnapshotReader(std::istream& in)
+///////////////////////////////////////////////////////////////////////////////
+  : m_in(in),
+    m_offset(0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void SnapshotReader::read_bytes(void* data, std::size_t num_bytes)
+///////////////////////////////////////////////////////////////////////////////
+{
+  m_in.read(static_cast<char*>(data), num_bytes);
+  RequireUser(m_in.good(), "Snapshot is truncated or unreadable");
+  m_offset += num_bytes;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SnapshotReader::align()
+///////////////////////////////////////////////////////////////////////////////
+{
+  char padding[SNAPSHOT_ALIGNMENT];
+  const unsigned remainder = m_offset % SNAPSHOT_ALIGNMENT;
+  if (remainder != 0) {
+    read_bytes(padding, SNAPSHOT_ALIGNMENT - remainder);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string SnapshotReader::read_string()
+///////////////////////////////////////////////////////////////////////////////
+{
+  const std::uint32_t size = read<std::uint32_t>();
+  RequireUser(size <= MAX_SNAPSHOT_STRING, "Corrupt snapshot, bad string length " << size);
+
+  std::string rv(size, '\0');
+  if (size > 0) {
+    read_bytes(&rv[0], size);
+  }
+  return rv;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t SnapshotReader::remaining()
+///////////////////////////////////////////////////////////////////////////////
+{
+  const std::istream::pos_type here = m_in.tellg();
+  if (here == std::istream::pos_type(-1)) {
+    m_in.clear();
+    return std::numeric_limits<std::uint64_t>::max();
+  }
+
+  m_in.seekg(0, std::ios::end);
+  const std::istream::pos_type end = m_in.tellg();
+  m_in.seekg(here);
+  RequireUser(m_in.good() && end != std::istream::pos_type(-1), "Snapshot is unreadable");
+
+  return end - here;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Location SnapshotReader::read_location()
+///////////////////////////////////////////////////////////////////////////////
+{
+  const unsigned row = read<unsigned>();
+  const unsigned col = read<unsigned>();
+  return Location(row, col);
+}
+
+/*****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////////
+void write_snapshot_header(SnapshotWriter& out)
+///////////////////////////////////////////////////////////////////////////////
+{
+  for (char c : SNAPSHOT_MAGIC) {
+    out.write(c);
+  }
+  out.write(SNAPSHOT_VERSION);
+  out.write(SNAPSHOT_ENDIAN_MARKER);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void read_snapshot_header(SnapshotReader& in)
+///////////////////////////////////////////////////////////////////////////////
+{
+  char magic[sizeof(SNAPSHOT_MAGIC)];
+  for (char& c : magic) {
+    c = in.read<char>();
+  }
+  RequireUser(std::memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) == 0,
+              "Not a baal snapshot");
+
+  const std::uint32_t version = in.read<std::uint32_t>();
+  RequireUser(version == SNAPSHOT_VERSION,
+              "Snapshot version " << version << " not supported, expected " << SNAPSHOT_VERSION);
+
+  const std::uint32_t endian_marker = in.read<std::uint32_t>();
+  RequireUser(endian_marker == SNAPSHOT_ENDIAN_MARKER,
+              "Snapshot was written on a machine with a different byte order");
+}
+
+}
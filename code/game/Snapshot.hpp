@@ -0,0 +1,144 @@
+#ifndef Snapshot_hpp
+#define Snapshot_hpp
+
+#include "BaalExceptions.hpp"
+#include "BaalCommon.hpp"
+
+#include <string>
+#include <vector>
+#include <iosfwd>
+#include <cstdint>
+#include <type_traits>
+
+// This file contains the binary snapshot format used to save and load
+// games. A snapshot is a small header followed by every object's fields,
+// written straight to the stream in a fixed order; there is no
+// intermediate document, so saving and loading are single streaming
+// passes. Each class that is part of the game state has a save method
+// that writes its fields and a load method that reads them back in the
+// same order.
+//
+// Values are written in native byte order and layout; the header records
+// both so that snapshots from an incompatible machine are rejected rather
+// than misread. Bulk arrays are 8-byte aligned relative to the start of
+// the snapshot so that a loader can map them directly.
+
+namespace baal {
+
+/**
+ * Writes snapshot data to a stream.
+ */
+class SnapshotWriter
+{
+ public:
+  explicit SnapshotWriter(std::ostream& out);
+
+  SnapshotWriter(const SnapshotWriter&) = delete;
+  SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+
+  // Write one arithmetic or enum value
+  template <typename T>
+  void write(const T& value)
+  {
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                  "Only plain values can be written directly");
+    write_bytes(&value, sizeof(T));
+  }
+
+  void write(const std::string& str);
+
+  void write(const Location& location);
+
+  // Write a length-prefixed, aligned array of plain values
+  template <typename T>
+  void write_array(const std::vector<T>& values)
+  {
+    static_assert(std::is_arithmetic<T>::value, "Only plain arrays can be written");
+    write<std::uint64_t>(values.size());
+    align();
+    write_bytes(values.data(), values.size() * sizeof(T));
+  }
+
+ private:
+  void write_bytes(const void* data, std::size_t num_bytes);
+
+  void align();
+
+  std::ostream& m_out;
+  std::uint64_t m_offset;
+};
+
+/**
+ * Reads snapshot data from a stream. Every read is checked; a truncated
+ * or corrupt snapshot results in a user error.
+ */
+class SnapshotReader
+{
+ public:
+  explicit SnapshotReader(std::istream& in);
+
+  SnapshotReader(const SnapshotReader&) = delete;
+  SnapshotReader& operator=(const SnapshotReader&) = delete;
+
+  template <typename T>
+  T read()
+  {
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                  "Only plain values can be read directly");
+    T value;
+    read_bytes(&value, sizeof(T));
+    return value;
+  }
+
+  std::string read_string();
+
+  Location read_location();
+
+  // Number of bytes left to read, or the largest value if the stream
+  // cannot tell
+  std::uint64_t remaining();
+
+  // Read an array written by write_array, which must have expected_size
+  // elements, into values
+  template <typename T>
+  void read_array(std::vector<T>& values, std::size_t expected_size)
+  {
+    static_assert(std::is_arithmetic<T>::value, "Only plain arrays can be read");
+    const std::uint64_t size = read<std::uint64_t>();
+    RequireUser(size == expected_size,
+                "Corrupt snapshot, expected array of " << expected_size << " but found " << size);
+    align();
+    values.resize(size);
+    read_bytes(values.data(), size * sizeof(T));
+  }
+
+  // Read an enum value, checking that it is in range
+  template <typename E>
+  E read_enum()
+  {
+    const E value = read<E>();
+    RequireUser(static_cast<unsigned>(value) < static_cast<unsigned>(size<E>()),
+                "Corrupt snapshot, bad enum value " << static_cast<int>(value));
+    return value;
+  }
+
+ private:
+  void read_bytes(void* data, std::size_t num_bytes);
+
+  void align();
+
+  std::istream& m_in;
+  std::uint64_t m_offset;
+};
+
+// Snapshot header, written first and checked first
+void write_snapshot_header(SnapshotWriter& out);
+
+void read_snapshot_header(SnapshotReader& in);
+
+// Bump this whenever the layout of any save method changes
+static constexpr std::uint32_t SNAPSHOT_VERSION = 5;
+
+}
+
+#endif
@@ -10,6 +10,7 @@
 #include <cmath>
 #include <limits>
 #include <algorithm>
+#include <sstream>
 
 using std::ostream;
 namespace mpl = boost::mpl;
@@ -22,6 +23,29 @@ constexpr int Fire::WIND_TIPPING_POINT;
 constexpr unsigned WindSpell::KILL_THRESHOLD;
 constexpr unsigned WindSpell::DAMAGE_THRESHOLD;
 
+constexpr SpellId Hot::ID;
+constexpr SpellId Cold::ID;
+constexpr SpellId WindSpell::ID;
+constexpr SpellId Infect::ID;
+constexpr SpellId Fire::ID;
+constexpr SpellId Tstorm::ID;
+constexpr SpellId Snow::ID;
+constexpr SpellId Avalanche::ID;
+constexpr SpellId Flood::ID;
+constexpr SpellId Dry::ID;
+constexpr SpellId Blizzard::ID;
+constexpr SpellId Tornado::ID;
+constexpr SpellId Heatwave::ID;
+constexpr SpellId Coldwave::ID;
+constexpr SpellId Drought::ID;
+constexpr SpellId Monsoon::ID;
+constexpr SpellId Disease::ID;
+constexpr SpellId Earthquake::ID;
+constexpr SpellId Hurricane::ID;
+constexpr SpellId Plague::ID;
+constexpr SpellId Volcano::ID;
+constexpr SpellId Asteroid::ID;
+
 const std::string Hot::NAME       = "hot";
 const std::string Cold::NAME      = "cold";
 const std::string WindSpell::NAME = "wind";
@@ -51,65 +75,105 @@ const std::string Volcano::NAME = "volcano";
 
 const std::string Asteroid::NAME = "asteroid";
 
-const SpellPrereq Hot::PREREQ       = {1, vecstr_t()};
-const SpellPrereq Cold::PREREQ      = {1, vecstr_t()};
-const SpellPrereq WindSpell::PREREQ = {1, vecstr_t()};
-const SpellPrereq Infect::PREREQ    = {1, vecstr_t()};
-
-const SpellPrereq Fire::PREREQ   = {5, vecstr_t({Hot::NAME})};
-const SpellPrereq Tstorm::PREREQ = {5, vecstr_t({WindSpell::NAME})};
-const SpellPrereq Snow::PREREQ   = {5, vecstr_t({Cold::NAME})};
-
-const SpellPrereq Avalanche::PREREQ = {10, vecstr_t({Snow::NAME})};
-const SpellPrereq Flood::PREREQ     = {10, vecstr_t({Tstorm::NAME})};
-const SpellPrereq Dry::PREREQ       = {10, vecstr_t({Fire::NAME})};
-const SpellPrereq Blizzard::PREREQ  = {10, vecstr_t({Snow::NAME})};
-const SpellPrereq Tornado::PREREQ   = {10, vecstr_t({Tstorm::NAME})};
-
-const SpellPrereq Heatwave::PREREQ = {15, vecstr_t({Dry::NAME})};
-const SpellPrereq Coldwave::PREREQ = {15, vecstr_t({Blizzard::NAME})};
-const SpellPrereq Drought::PREREQ  = {15, vecstr_t({Dry::NAME})};
-const SpellPrereq Monsoon::PREREQ  = {15, vecstr_t({Flood::NAME})};
-
-const SpellPrereq Disease::PREREQ    = {20, vecstr_t({Infect::NAME})};
-const SpellPrereq Earthquake::PREREQ = {20, vecstr_t()};
-const SpellPrereq Hurricane::PREREQ  = {20, vecstr_t({Monsoon::NAME})};
-
-const SpellPrereq Plague::PREREQ  = {25, vecstr_t({Disease::NAME})};
-const SpellPrereq Volcano::PREREQ = {25, vecstr_t({Earthquake::NAME})};
+const SpellPrereq Hot::PREREQ       = {1, {}};
+const SpellPrereq Cold::PREREQ      = {1, {}};
+const SpellPrereq WindSpell::PREREQ = {1, {}};
+const SpellPrereq Infect::PREREQ    = {1, {}};
+
+const SpellPrereq Fire::PREREQ   = {5, {Hot::ID}};
+const SpellPrereq Tstorm::PREREQ = {5, {WindSpell::ID}};
+const SpellPrereq Snow::PREREQ   = {5, {Cold::ID}};
+
+const SpellPrereq Avalanche::PREREQ = {10, {Snow::ID}};
+const SpellPrereq Flood::PREREQ     = {10, {Tstorm::ID}};
+const SpellPrereq Dry::PREREQ       = {10, {Fire::ID}};
+const SpellPrereq Blizzard::PREREQ  = {10, {Snow::ID}};
+const SpellPrereq Tornado::PREREQ   = {10, {Tstorm::ID}};
+
+const SpellPrereq Heatwave::PREREQ = {15, {Dry::ID}};
+const SpellPrereq Coldwave::PREREQ = {15, {Blizzard::ID}};
+const SpellPrereq Drought::PREREQ  = {15, {Dry::ID}};
+const SpellPrereq Monsoon::PREREQ  = {15, {Flood::ID}};
+
+const SpellPrereq Disease::PREREQ    = {20, {Infect::ID}};
+const SpellPrereq Earthquake::PREREQ = {20, {}};
+const SpellPrereq Hurricane::PREREQ  = {20, {Monsoon::ID}};
+
+const SpellPrereq Plague::PREREQ  = {25, {Disease::ID}};
+const SpellPrereq Volcano::PREREQ = {25, {Earthquake::ID}};
+
+const SpellPrereq Asteroid::PREREQ = {30, {Volcano::ID}};
+
+///////////////////////////////////////////////////////////////////////////////
+std::string SpellCheck::message() const
+///////////////////////////////////////////////////////////////////////////////
+{
+  std::ostringstream out;
+  switch (m_code) {
+  case OK:
+    break;
+  case ALREADY_CAST:
+    out << "Already cast " << *m_spell_name << " on this tile";
+    break;
+  case NEEDS_CITY:
+    out << "Must cast " << *m_spell_name << " on a city";
+    break;
+  case NEEDS_PLANT_GROWTH:
+    out << "Must cast " << *m_spell_name << " on a tile with plant growth";
+    break;
+  case NEEDS_LAND:
+    out << "Must cast " << *m_spell_name << " on a land tile";
+    break;
+  case NEEDS_HILLS_OR_MOUNTAINS:
+    out << "Must cast " << *m_spell_name << " on a hill or mountain tile";
+    break;
+  case NEEDS_SNOWPACK:
+    out << "There is no snow on this tile for " << *m_spell_name;
+    break;
+  case NEEDS_SOIL_MOISTURE:
+    out << "Must cast " << *m_spell_name << " on a tile with soil moisture";
+    break;
+  case TOO_WARM:
+    out << "It is not cold enough on this tile for " << *m_spell_name
+        << ", maximum temp for this spell is " << m_limit;
+    break;
+  case TOO_COLD:
+    out << "It is too cold on this tile for " << *m_spell_name
+        << ", temp must be above " << m_limit;
+    break;
+  default:
+    Require(false, "Unhandled spell check: " << m_code);
+  }
+  return out.str();
+}
 
-const SpellPrereq Asteroid::PREREQ = {30, vecstr_t({Volcano::NAME})};
+/*****************************************************************************/
 
 ///////////////////////////////////////////////////////////////////////////////
-Spell::Spell(const std::string& name,
-             unsigned           spell_level,
-             const Location&    location,
-             unsigned           base_cost,
-             const SpellPrereq& prereq,
-             Engine&            engine,
-             const SpellSpec&   spec)
+Spell::Spell(const SpellPrototype& prototype,
+             unsigned              spell_level,
+             const Location&       location,
+             Engine&               engine)
 ///////////////////////////////////////////////////////////////////////////////
-  : m_name(name),
+  : m_prototype(prototype),
     m_spell_level(spell_level),
     m_location(location),
-    m_base_cost(base_cost),
-    m_prereq(prereq),
-    m_engine(engine),
-    m_spec(spec)
+    m_engine(engine)
 {
-  Assert(SpellFactory::is_in_all_names(name), name);
+  Assert(id() < SpellIdLAST, name());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 std::pair<unsigned, bool> Spell::kill_base(WorldTile const& tile, float destructiveness) const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  float base_pct = m_spec.m_kill_spec.first(tile, destructiveness);
+  const SpellSpecBase& spec = m_prototype.m_spec;
+  float base_pct = spec.base(SpellSpecBase::KILL, tile, destructiveness);
   SPELL_REPORT("base kill %: " << base_pct);
-  for (auto factor : m_spec.m_kill_spec.second) {
-    const float mitigation_multiplier = factor.second(tile);
-    base_pct /= mitigation_multiplier;
-    SPELL_REPORT(factor.first << ": " << mitigation_multiplier);
+  factor_report_t report;
+  base_pct = spec.mitigate(SpellSpecBase::KILL, base_pct, tile, m_spell_level, m_engine, &report);
+  for (const auto& factor : report) {
+    SPELL_REPORT(factor.first << ": " << factor.second);
   }
 
   SPELL_REPORT("final kill %: " << base_pct);
@@ -133,9 +197,12 @@ std::pair<unsigned, bool> Spell::kill(City& city,
 
   if (city.population() < City::MIN_CITY_SIZE) {
     SPELL_REPORT("obliterated city '" << city.name() << "'");
+    // Finish off the survivors first; remove_city frees the city, and its
+    // column slot is reused by another city. Survivors count toward exp.
+    const unsigned survivors = city.population();
+    city.kill(survivors);
+    num_killed += survivors;
     m_engine.world().remove_city(city);
-    city.kill(city.population());
-    num_killed += city.population();
 
     // TODO: Give bigger city-kill bonus based on maximum attained rank of
     // city.
@@ -147,18 +214,19 @@ std::pair<unsigned, bool> Spell::kill(City& city,
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-unsigned Spell::damage(LandTile& tile, float destructiveness, const base_factor_pair_t& spec, const std::string& name) const
+unsigned Spell::damage(LandTile& tile, float destructiveness, SpellSpecBase::Effect effect, const std::string& name) const
 ///////////////////////////////////////////////////////////////////////////////
 {
   Require(name == "defense" || name == "infrastructure", "Unknown name " << name);
 
-  float num_destroyed = spec.first(tile, destructiveness);
+  const SpellSpecBase& spec = m_prototype.m_spec;
+  float num_destroyed = spec.base(effect, tile, destructiveness);
   if (num_destroyed != DOES_NOT_APPLY) {
     SPELL_REPORT("base " << name << " damage capacity: " << num_destroyed);
-    for (auto factor : spec.second) {
-      const float mitigation_multiplier = factor.second(tile);
-      num_destroyed /= mitigation_multiplier;
-      SPELL_REPORT(factor.first << ": " << mitigation_multiplier);
+    factor_report_t report;
+    num_destroyed = spec.mitigate(effect, num_destroyed, tile, m_spell_level, m_engine, &report);
+    for (const auto& factor : report) {
+      SPELL_REPORT(factor.first << ": " << factor.second);
     }
 
     unsigned damage_capacity = std::round(num_destroyed);
@@ -214,7 +282,7 @@ unsigned Spell::destroy(LandTile& tile, unsigned max_destroyed, const std::strin
 void Spell::damage_tile(LandTile& tile, float destructiveness) const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  float damage_pct = m_spec.m_tile_dmg_spec(tile, destructiveness);
+  float damage_pct = m_prototype.m_spec.tile_dmg(tile, destructiveness);
   if (damage_pct != DOES_NOT_APPLY) {
     if (damage_pct > 0.0) {
       LandTile& land_tile = dynamic_cast<LandTile&>(tile);
@@ -227,53 +295,57 @@ void Spell::damage_tile(LandTile& tile, float destructiveness) const
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-unsigned Spell::trigger(const std::string& spell_name, unsigned spell_level) const
+unsigned Spell::trigger(SpellId spell_id, unsigned spell_level) const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  auto spell = SpellFactory::create_spell(spell_name,
+  auto spell = SpellFactory::create_spell(spell_id,
                                           m_engine,
                                           spell_level,
                                           m_location);
 
-  // Check if this spell can be applied here
-  try {
-    spell->verify_apply();
-
-    SPELL_REPORT("caused a level " << spell_level << " " << spell_name);
-
-    unsigned exp = CHAIN_REACTION_BONUS * spell->apply();
-    return exp;
-  }
-  catch (UserError& error) {
+  // Check if this spell can be applied here. Failing is common, so this
+  // must stay cheap; see SpellCheck.
+  if (!spell->check_apply().ok()) {
     return 0;
   }
+
+  SPELL_REPORT("caused a level " << spell_level << " " << spell->name());
+
+  return CHAIN_REACTION_BONUS * spell->apply();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-float Spell::compute_destructiveness(const WorldTile& tile, bool report) const
+void Spell::verify_apply() const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  factor_vector_t const& factors = m_spec.m_destructiveness_spec;
-  float rv = 1.0;
-  for (auto factor : factors) {
-    const float factor_multiplier = factor.second(tile);
-    rv *= factor_multiplier;
-    if (report) {
-      SPELL_REPORT(factor.first << ": " << factor_multiplier);
-    }
+  const SpellCheck check = check_apply();
+  RequireUser(check.ok(), check.message());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float Spell::compute_destructiveness(const WorldTile& tile, bool report, bool with_land) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  const SpellSpecBase& spec = m_prototype.m_spec;
+  if (!report) {
+    return spec.destructiveness(tile, m_spell_level, m_engine, with_land, nullptr);
   }
-  if (report) {
-    SPELL_REPORT("total destructiveness: " << rv);
+
+  factor_report_t factors;
+  const float rv = spec.destructiveness(tile, m_spell_level, m_engine, with_land, &factors);
+  for (const auto& factor : factors) {
+    SPELL_REPORT(factor.first << ": " << factor.second);
   }
+  SPELL_REPORT("total destructiveness: " << rv);
   return rv;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Spell::verify_no_repeat_cast() const
+SpellCheck Spell::check_no_repeat_cast() const
 ///////////////////////////////////////////////////////////////////////////////
 {
   const WorldTile& tile = m_engine.world().get_tile(m_location);
-  RequireUser(!tile.already_casted(m_name), "Already cast " << m_name << " on this tile");
+  return tile.already_casted(id()) ? SpellCheck(SpellCheck::ALREADY_CAST, name()) : SpellCheck();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -293,7 +365,7 @@ unsigned Spell::apply() const
   WorldTile& tile      = world.get_tile(m_location);
   unsigned exp         = 0;
 
-  std::vector<std::pair<std::string, unsigned>> triggered;
+  std::vector<std::pair<SpellId, unsigned>> triggered;
   std::vector<WorldTile*> affected_tiles;
   apply_to_world(tile, affected_tiles, triggered);
   Require( !affected_tiles.empty(), "No affected tiles?" );
@@ -302,7 +374,7 @@ unsigned Spell::apply() const
     const float destructiveness = compute_destructiveness(*affected_tile, true /*report*/);
 
     if (affected_tile->infra_level() > 0) {
-      exp += damage(dynamic_cast<LandTile&>(*affected_tile), destructiveness, m_spec.m_infra_dmg_spec, "infrastructure");
+      exp += damage(dynamic_cast<LandTile&>(*affected_tile), destructiveness, SpellSpecBase::INFRA_DMG, "infrastructure");
     }
     else if (affected_tile->city() != nullptr) {
       // order matters here!
@@ -310,7 +382,7 @@ unsigned Spell::apply() const
       exp += result.first;
       if (!result.second) {
         // city was not wiped, still exists
-        exp += damage(dynamic_cast<LandTile&>(*affected_tile), destructiveness, m_spec.m_defense_dmg_spec, "defense");
+        exp += damage(dynamic_cast<LandTile&>(*affected_tile), destructiveness, SpellSpecBase::DEFENSE_DMG, "defense");
       }
     }
 
@@ -320,7 +392,7 @@ unsigned Spell::apply() const
     }
 
     // Register that spell was cast on this tile
-    affected_tile->cast(m_name);
+    affected_tile->cast(id());
   }
 
   for (auto trig : triggered) {
@@ -340,16 +412,16 @@ ostream& operator<<(ostream& out, const Spell& spell)
 /*****************************************************************************/
 
 ///////////////////////////////////////////////////////////////////////////////
-void Hot::verify_apply() const
+SpellCheck Hot::check_apply() const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  verify_no_repeat_cast();
+  return check_no_repeat_cast();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Hot::apply_to_world(WorldTile& tile,
                          std::vector<WorldTile*>& affected_tiles,
-                         std::vector<std::pair<std::string, unsigned>>& triggered) const
+                         std::vector<std::pair<SpellId, unsigned>>& triggered) const
 ///////////////////////////////////////////////////////////////////////////////
 {
   Atmosphere& atmos    = tile.atmosphere();
@@ -360,7 +432,7 @@ void Hot::apply_to_world(WorldTile& tile,
 
   // Regardless of tile type, atmosphere is warmed
   const int prior_temp = atmos.temperature();
-  const unsigned warmup = m_degrees_heated_land(tile, m_spell_level);
+  const unsigned warmup = degrees_heated_land(tile, m_spell_level);
   const int new_temp = prior_temp + warmup;
   atmos.set_temperature(new_temp);
   SPELL_REPORT("raised temperature from " << prior_temp << " to " << new_temp);
@@ -368,7 +440,7 @@ void Hot::apply_to_world(WorldTile& tile,
   if (ocean_tile != nullptr) {
     // Heat ocean surface up
     const int prior_ocean_temp = ocean_tile->surface_temp();
-    const int ocean_warmup = m_degrees_heated_ocean(tile, m_spell_level);
+    const int ocean_warmup = degrees_heated_ocean(tile, m_spell_level);
     const int new_ocean_temp = prior_ocean_temp + ocean_warmup;
     ocean_tile->set_surface_temp(new_ocean_temp);
     SPELL_REPORT("raised ocean surface temperature from " <<
@@ -390,16 +462,16 @@ void Hot::apply_to_world(WorldTile& tile,
 /*****************************************************************************/
 
 ///////////////////////////////////////////////////////////////////////////////
-void Cold::verify_apply() const
+SpellCheck Cold::check_apply() const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  verify_no_repeat_cast();
+  return check_no_repeat_cast();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Cold::apply_to_world(WorldTile& tile,
                           std::vector<WorldTile*>& affected_tiles,
-                          std::vector<std::pair<std::string, unsigned>>& triggered) const
+                          std::vector<std::pair<SpellId, unsigned>>& triggered) const
 ///////////////////////////////////////////////////////////////////////////////
 {
   Atmosphere& atmos    = tile.atmosphere();
@@ -409,7 +481,7 @@ void Cold::apply_to_world(WorldTile& tile,
 
   // Regardless of tile type, atmosphere is cooled
   const int prior_temp = atmos.temperature();
-  const unsigned cooldown = m_degrees_cooled_land(tile, m_spell_level);
+  const unsigned cooldown = degrees_cooled_land(tile, m_spell_level);
   const int new_temp = prior_temp - cooldown;
   atmos.set_temperature(new_temp);
   SPELL_REPORT("reduced temperature from " << prior_temp << " to " << new_temp);
@@ -417,7 +489,7 @@ void Cold::apply_to_world(WorldTile& tile,
   if (ocean_tile != nullptr) {
     // Cool ocean surface down
     const int prior_ocean_temp = ocean_tile->surface_temp();
-    const unsigned ocean_cooldown = m_degrees_cooled_ocean(tile, m_spell_level);
+    const unsigned ocean_cooldown = degrees_cooled_ocean(tile, m_spell_level);
     int new_ocean_temp = prior_ocean_temp - ocean_cooldown;
 
     // Once frozen, ocean temps cannot go lower
@@ -436,7 +508,7 @@ void Cold::apply_to_world(WorldTile& tile,
 /*****************************************************************************/
 
 ///////////////////////////////////////////////////////////////////////////////
-void Infect::verify_apply() const
+SpellCheck Infect::check_apply() const
 ///////////////////////////////////////////////////////////////////////////////
 {
   // This spell can only be cast on cities
@@ -445,15 +517,17 @@ void Infect::verify_apply() const
 
   // Check for city
   City* city = tile.city();
-  RequireUser(city != nullptr, "Must cast " << m_name << " on a city.");
+  if (city == nullptr) {
+    return SpellCheck(SpellCheck::NEEDS_CITY, name());
+  }
 
-  verify_no_repeat_cast();
+  return check_no_repeat_cast();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Infect::apply_to_world(WorldTile& tile,
                             std::vector<WorldTile*>& affected_tiles,
-                            std::vector<std::pair<std::string, unsigned>>& triggered) const
+                            std::vector<std::pair<SpellId, unsigned>>& triggered) const
 ///////////////////////////////////////////////////////////////////////////////
 {
   // No affect on world properties
@@ -463,23 +537,23 @@ void Infect::apply_to_world(WorldTile& tile,
 /*****************************************************************************/
 
 ///////////////////////////////////////////////////////////////////////////////
-void WindSpell::verify_apply() const
+SpellCheck WindSpell::check_apply() const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  verify_no_repeat_cast();
+  return check_no_repeat_cast();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void WindSpell::apply_to_world(WorldTile& tile,
                                std::vector<WorldTile*>& affected_tiles,
-                               std::vector<std::pair<std::string, unsigned>>& triggered) const
+                               std::vector<std::pair<SpellId, unsigned>>& triggered) const
 ///////////////////////////////////////////////////////////////////////////////
 {
   Atmosphere& atmos = tile.atmosphere();
 
   // Compute and apply new wind speed
   const Wind prior_wind = atmos.wind();
-  const unsigned speedup = m_wind_speedup(tile, m_spell_level);
+  const unsigned speedup = wind_speedup(tile, m_spell_level);
   const Wind new_wind = prior_wind + speedup;
   const unsigned new_wind_speed = new_wind.m_speed;
   atmos.set_wind(new_wind);
@@ -492,23 +566,24 @@ void WindSpell::apply_to_world(WorldTile& tile,
 /*****************************************************************************/
 
 ///////////////////////////////////////////////////////////////////////////////
-void Fire::verify_apply() const
+SpellCheck Fire::check_apply() const
 ///////////////////////////////////////////////////////////////////////////////
 {
   // This spell can only be cast on tiles with plant growth
 
   WorldTile& tile = m_engine.world().get_tile(m_location);
   FoodTile* food_tile = dynamic_cast<FoodTile*>(&tile);
-  RequireUser(food_tile != nullptr,
-              "Fire can only be cast on tiles with plant growth");
+  if (food_tile == nullptr) {
+    return SpellCheck(SpellCheck::NEEDS_PLANT_GROWTH, name());
+  }
 
-  verify_no_repeat_cast();
+  return check_no_repeat_cast();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Fire::apply_to_world(WorldTile& tile,
                           std::vector<WorldTile*>& affected_tiles,
-                          std::vector<std::pair<std::string, unsigned>>& triggered) const
+                          std::vector<std::pair<SpellId, unsigned>>& triggered) const
 ///////////////////////////////////////////////////////////////////////////////
 {
   // No extra effects on world.
@@ -518,37 +593,38 @@ void Fire::apply_to_world(WorldTile& tile,
 /*****************************************************************************/
 
 ///////////////////////////////////////////////////////////////////////////////
-void Tstorm::verify_apply() const
+SpellCheck Tstorm::check_apply() const
 ///////////////////////////////////////////////////////////////////////////////
 {
   // This spell can only be cast on plains and lush tiles (food tiles).
 
   WorldTile& tile = m_engine.world().get_tile(m_location);
   FoodTile* food_tile = dynamic_cast<FoodTile*>(&tile);
-  RequireUser(food_tile != nullptr,
-              "Tstorm can only be cast on tiles with plant growth");
+  if (food_tile == nullptr) {
+    return SpellCheck(SpellCheck::NEEDS_PLANT_GROWTH, name());
+  }
 
-  verify_no_repeat_cast();
+  return check_no_repeat_cast();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Tstorm::apply_to_world(WorldTile& tile,
                             std::vector<WorldTile*>& affected_tiles,
-                            std::vector<std::pair<std::string, unsigned>>& triggered) const
+                            std::vector<std::pair<SpellId, unsigned>>& triggered) const
 ///////////////////////////////////////////////////////////////////////////////
 {
   const float destructiveness = compute_destructiveness(tile, false);
 
-  const unsigned wind_spawn_level     = m_wind_spawn_func(destructiveness);
-  const unsigned flood_spawn_level    = m_flood_spawn_func(destructiveness);
-  const unsigned tornado_spawn_level  = m_tornado_spawn_func(destructiveness);
+  const unsigned wind_spawn_level     = wind_spawn_func(destructiveness);
+  const unsigned flood_spawn_level    = flood_spawn_func(destructiveness);
+  const unsigned tornado_spawn_level  = tornado_spawn_func(destructiveness);
 
   if (wind_spawn_level > 0) {
-    triggered.push_back(std::make_pair(WindSpell::NAME, wind_spawn_level));
+    triggered.push_back(std::make_pair(WindSpell::ID, wind_spawn_level));
   }
 
   if (flood_spawn_level > 0) {
-    triggered.push_back(std::make_pair(Flood::NAME, flood_spawn_level));
+    triggered.push_back(std::make_pair(Flood::ID, flood_spawn_level));
   }
   else {
     // Some minimal impact on soil moisture, but this tstorm was not
@@ -559,7 +635,7 @@ void Tstorm::apply_to_world(WorldTile& tile,
   }
 
   if (tornado_spawn_level > 0) {
-    triggered.push_back(std::make_pair(Tornado::NAME, tornado_spawn_level));
+    triggered.push_back(std::make_pair(Tornado::ID, tornado_spawn_level));
   }
 
   // TODO: Need a better system for this (computing affected area)
@@ -567,30 +643,32 @@ void Tstorm::apply_to_world(WorldTile& tile,
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Snow::verify_apply() const
+SpellCheck Snow::check_apply() const
 ///////////////////////////////////////////////////////////////////////////////
 {
   // Must be cast on a land tile
   WorldTile& tile = m_engine.world().get_tile(m_location);
   LandTile* land_tile = dynamic_cast<LandTile*>(&tile);
-  RequireUser(land_tile != nullptr,
-              "Snow can only be cast on land tiles");
+  if (land_tile == nullptr) {
+    return SpellCheck(SpellCheck::NEEDS_LAND, name());
+  }
 
   // Must be cold
-  RequireUser(tile.atmosphere().temperature() <= MAX_TEMP,
-              "It is not cold enough on this tile for it to snow, maximum temp for this spell is " << MAX_TEMP);
+  if (tile.atmosphere().temperature() > MAX_TEMP) {
+    return SpellCheck(SpellCheck::TOO_WARM, name(), MAX_TEMP);
+  }
 
-  verify_no_repeat_cast();
+  return check_no_repeat_cast();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Snow::apply_to_world(WorldTile& tile,
                           std::vector<WorldTile*>& affected_tiles,
-                          std::vector<std::pair<std::string, unsigned>>& triggered) const
+                          std::vector<std::pair<SpellId, unsigned>>& triggered) const
 ///////////////////////////////////////////////////////////////////////////////
 {
   const float destructiveness = compute_destructiveness(tile, false);
-  const unsigned snowfall = m_snowfall_func(destructiveness);
+  const unsigned snowfall = snowfall_func(destructiveness);
   const unsigned new_snowpack = tile.snowpack() + snowfall;
   SPELL_REPORT("With " << snowfall << " inches of snowfall, snowpack raised to " << new_snowpack);
   tile.set_snowpack(new_snowpack);
@@ -599,26 +677,29 @@ void Snow::apply_to_world(WorldTile& tile,
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Avalanche::verify_apply() const
+SpellCheck Avalanche::check_apply() const
 ///////////////////////////////////////////////////////////////////////////////
 {
   // Must be cast on a hill or mountain tile
   WorldTile& tile = m_engine.world().get_tile(m_location);
   HillsTile* hills_tile = dynamic_cast<HillsTile*>(&tile);
   MountainTile* mtn_tile = dynamic_cast<MountainTile*>(&tile);
-  RequireUser(hills_tile != nullptr || mtn_tile != nullptr,
-              "Avalanche can only be cast on hill or mountain tiles");
+  if (hills_tile == nullptr && mtn_tile == nullptr) {
+    return SpellCheck(SpellCheck::NEEDS_HILLS_OR_MOUNTAINS, name());
+  }
 
   // Must have snow
-  RequireUser(tile.snowpack() > 0, "There is no snow on this tile");
+  if (tile.snowpack() == 0) {
+    return SpellCheck(SpellCheck::NEEDS_SNOWPACK, name());
+  }
 
-  verify_no_repeat_cast();
+  return check_no_repeat_cast();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Avalanche::apply_to_world(WorldTile& tile,
                           std::vector<WorldTile*>& affected_tiles,
-                          std::vector<std::pair<std::string, unsigned>>& triggered) const
+                          std::vector<std::pair<SpellId, unsigned>>& triggered) const
 ///////////////////////////////////////////////////////////////////////////////
 {
   // No extra effects on world.
@@ -626,40 +707,37 @@ void Avalanche::apply_to_world(WorldTile& tile,
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Flood::verify_apply() const
+SpellCheck Flood::check_apply() const
 ///////////////////////////////////////////////////////////////////////////////
 {
   // Must be cast on a land tile
   WorldTile& tile = m_engine.world().get_tile(m_location);
   LandTile* land_tile = dynamic_cast<LandTile*>(&tile);
-  RequireUser(land_tile != nullptr,
-              "Flood can only be cast on land tiles");
+  if (land_tile == nullptr) {
+    return SpellCheck(SpellCheck::NEEDS_LAND, name());
+  }
 
-  // Must have snow
-  RequireUser(tile.atmosphere().temperature() > MIN_TEMP,
-              "Too cold to flood, temp must be avove " << MIN_TEMP);
+  // Must be warm enough to rain
+  if (tile.atmosphere().temperature() <= MIN_TEMP) {
+    return SpellCheck(SpellCheck::TOO_COLD, name(), MIN_TEMP);
+  }
 
-  verify_no_repeat_cast();
+  return check_no_repeat_cast();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Flood::apply_to_world(WorldTile& tile,
                           std::vector<WorldTile*>& affected_tiles,
-                          std::vector<std::pair<std::string, unsigned>>& triggered) const
+                          std::vector<std::pair<SpellId, unsigned>>& triggered) const
 ///////////////////////////////////////////////////////////////////////////////
 {
   World& world = m_engine.world();
 
-  factor_vector_t const& factors = m_spec.m_destructiveness_spec;
-  float destructiveness_without_land_factors = 1.0;
-  for (auto factor : factors) {
-    if (factor.first != "moisture" && factor.first != "elevation") {
-      const float factor_multiplier = factor.second(tile);
-      destructiveness_without_land_factors *= factor_multiplier;
-    }
-  }
+  // Rain and drying do not depend on the ground they fall on
+  const float destructiveness_without_land_factors =
+    compute_destructiveness(tile, false /*report*/, false /*with_land*/);
 
-  const float rainfall = m_rainfall_func(destructiveness_without_land_factors);
+  const float rainfall = rainfall_func(destructiveness_without_land_factors);
   const float average_precip = tile.climate().precip(world.time().season());
   const float orig_moisture = tile.soil_moisture();
   const float added_moisture = rainfall / average_precip;
@@ -672,36 +750,32 @@ void Flood::apply_to_world(WorldTile& tile,
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Dry::verify_apply() const
+SpellCheck Dry::check_apply() const
 ///////////////////////////////////////////////////////////////////////////////
 {
   // This spell can only be cast on tiles with soil moisture
 
   WorldTile& tile = m_engine.world().get_tile(m_location);
   TileWithSoil* soil_tile = dynamic_cast<TileWithSoil*>(&tile);
-  RequireUser(soil_tile != nullptr,
-              "Dry can only be cast on tiles with soil moisture");
+  if (soil_tile == nullptr) {
+    return SpellCheck(SpellCheck::NEEDS_SOIL_MOISTURE, name());
+  }
 
-  verify_no_repeat_cast();
+  return check_no_repeat_cast();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Dry::apply_to_world(WorldTile& tile,
                          std::vector<WorldTile*>& affected_tiles,
-                         std::vector<std::pair<std::string, unsigned>>& triggered) const
+                         std::vector<std::pair<SpellId, unsigned>>& triggered) const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  factor_vector_t const& factors = m_spec.m_destructiveness_spec;
-  float destructiveness_without_land_factors = 1.0;
-  for (auto factor : factors) {
-    if (factor.first != "moisture") {
-      const float factor_multiplier = factor.second(tile);
-      destructiveness_without_land_factors *= factor_multiplier;
-    }
-  }
+  // Rain and drying do not depend on the ground they fall on
+  const float destructiveness_without_land_factors =
+    compute_destructiveness(tile, false /*report*/, false /*with_land*/);
 
   const float orig_moisture = tile.soil_moisture();
-  const float lost_moisture = m_moisture_reduction_fraction_func(destructiveness_without_land_factors);
+  const float lost_moisture = moisture_reduction_fraction_func(destructiveness_without_land_factors);
   const float new_moisture  = orig_moisture - lost_moisture;
   tile.set_soil_moisture(new_moisture);
 
@@ -713,23 +787,24 @@ void Dry::apply_to_world(WorldTile& tile,
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Tornado::verify_apply() const
+SpellCheck Tornado::check_apply() const
 ///////////////////////////////////////////////////////////////////////////////
 {
   // This spell can only be cast on plains and lush tiles (food tiles).
 
   WorldTile& tile = m_engine.world().get_tile(m_location);
   FoodTile* food_tile = dynamic_cast<FoodTile*>(&tile);
-  RequireUser(food_tile != nullptr,
-              "Tornado can only be cast on tiles with plant growth");
+  if (food_tile == nullptr) {
+    return SpellCheck(SpellCheck::NEEDS_PLANT_GROWTH, name());
+  }
 
-  verify_no_repeat_cast();
+  return check_no_repeat_cast();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Tornado::apply_to_world(WorldTile& tile,
                              std::vector<WorldTile*>& affected_tiles,
-                             std::vector<std::pair<std::string, unsigned>>& triggered) const
+                             std::vector<std::pair<SpellId, unsigned>>& triggered) const
 ///////////////////////////////////////////////////////////////////////////////
 {
   World& world = m_engine.world();
@@ -748,26 +823,28 @@ void Tornado::apply_to_world(WorldTile& tile,
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Blizzard::verify_apply() const
+SpellCheck Blizzard::check_apply() const
 ///////////////////////////////////////////////////////////////////////////////
 {
   // Must be cast on a land tile
   WorldTile& tile = m_engine.world().get_tile(m_location);
   LandTile* land_tile = dynamic_cast<LandTile*>(&tile);
-  RequireUser(land_tile != nullptr,
-              "Blizzard can only be cast on land tiles");
+  if (land_tile == nullptr) {
+    return SpellCheck(SpellCheck::NEEDS_LAND, name());
+  }
 
   // Must be cold
-  RequireUser(tile.atmosphere().temperature() <= MAX_TEMP,
-              "It is not cold enough on this tile for a blizzard, maximum temp for this spell is " << MAX_TEMP);
+  if (tile.atmosphere().temperature() > MAX_TEMP) {
+    return SpellCheck(SpellCheck::TOO_WARM, name(), MAX_TEMP);
+  }
 
-  verify_no_repeat_cast();
+  return check_no_repeat_cast();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void Blizzard::apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const
 ///////////////////////////////////////////////////////////////////////////////
 {
   World& world = m_engine.world();
@@ -777,7 +854,7 @@ void Blizzard::apply_to_world(WorldTile& tile,
     affected_tiles.push_back(&affected_tile);
 
     const float destructiveness = compute_destructiveness(affected_tile, false);
-    const unsigned snowfall = m_snowfall_func(destructiveness);
+    const unsigned snowfall = snowfall_func(destructiveness);
     const unsigned new_snowpack = affected_tile.snowpack() + snowfall;
     SPELL_REPORT("With " << snowfall << " inches of snowfall, snowpack raised to " << new_snowpack);
     affected_tile.set_snowpack(new_snowpack);
@@ -2,6 +2,7 @@
 #define Spell_hpp
 
 #include "SpellFactory.hpp"
+#include "SpellSpec.hpp"
 #include "BaalCommon.hpp"
 #include "BaalMath.hpp"
 #include "PlayerAI.hpp"
@@ -29,32 +30,70 @@ class Engine;
  */
 struct SpellPrereq
 {
+  typedef std::vector<SpellId> spells_type;
+
   unsigned min_player_level() const { return m_min_player_level; }
 
-  vecstr_t::const_iterator begin() const { return std::begin(m_min_spell_prereqs); }
+  spells_type::const_iterator begin() const { return std::begin(m_min_spell_prereqs); }
 
-  vecstr_t::const_iterator end() const { return std::end(m_min_spell_prereqs); }
+  spells_type::const_iterator end() const { return std::end(m_min_spell_prereqs); }
 
-  unsigned m_min_player_level;
-  vecstr_t m_min_spell_prereqs;
+  unsigned    m_min_player_level;
+  spells_type m_min_spell_prereqs;
 };
 
-const float DOES_NOT_APPLY = -1.0;
-
-typedef std::function<float(const WorldTile&)> factor_function_t;
-typedef std::pair<std::string, factor_function_t> factor_t;
-typedef std::vector<factor_t> factor_vector_t;
-typedef std::function<float(const WorldTile&, float)> base_function_t;
-typedef std::pair<base_function_t, factor_vector_t> base_factor_pair_t;
+/**
+ * Everything about a kind of spell that does not depend on the cast. Each
+ * spell class builds its prototype once, on first use; spell objects only
+ * add level, location and engine.
+ */
+struct SpellPrototype
+{
+  SpellId              m_id;
+  const std::string&   m_name;
+  unsigned             m_base_cost;
+  const SpellPrereq&   m_prereq;
+  const SpellSpecBase& m_spec;
+};
 
-// Functors that describe how a spell works
-struct SpellSpec
+/**
+ * The outcome of checking whether a spell can be applied where it was
+ * cast: OK, or why not. The message is only formatted when asked for, so
+ * checks that are expected to fail often (chain reactions, previews) cost
+ * no more than the test itself.
+ */
+class SpellCheck
 {
-  factor_vector_t    m_destructiveness_spec;
-  base_factor_pair_t m_kill_spec;
-  base_factor_pair_t m_infra_dmg_spec;
-  base_factor_pair_t m_defense_dmg_spec;
-  base_function_t    m_tile_dmg_spec;
+ public:
+  enum Code {
+    OK,
+    ALREADY_CAST,
+    NEEDS_CITY,
+    NEEDS_PLANT_GROWTH,
+    NEEDS_LAND,
+    NEEDS_HILLS_OR_MOUNTAINS,
+    NEEDS_SNOWPACK,
+    NEEDS_SOIL_MOISTURE,
+    TOO_WARM, // limit is the maximum temperature
+    TOO_COLD  // limit is the minimum temperature
+  };
+
+  SpellCheck() : m_code(OK), m_spell_name(nullptr), m_limit(0) {}
+
+  SpellCheck(Code code, const std::string& spell_name, int limit = 0)
+    : m_code(code), m_spell_name(&spell_name), m_limit(limit)
+  {}
+
+  bool ok() const { return m_code == OK; }
+
+  Code code() const { return m_code; }
+
+  std::string message() const;
+
+ private:
+  Code               m_code;
+  const std::string* m_spell_name; // prototype names live forever
+  int                m_limit;
 };
 
 /**
@@ -64,13 +103,10 @@ struct SpellSpec
 class Spell
 {
  public:
-  Spell(const std::string&  name,
-        unsigned            spell_level,
-        const Location&     location,
-        unsigned            base_cost,
-        const SpellPrereq&  prereq,
-        Engine&             engine,
-        const SpellSpec&    spec);
+  Spell(const SpellPrototype& prototype,
+        unsigned              spell_level,
+        const Location&       location,
+        Engine&               engine);
 
   virtual ~Spell() = default;
 
@@ -81,10 +117,12 @@ class Spell
   // API
   //
 
-  // Verify that the user's attempt to cast this spell is sane.
-  // This method should throw user errors so that apply doesn't
-  // have to.
-  virtual void verify_apply() const = 0;
+  // Check that an attempt to cast this spell is sane, without throwing.
+  virtual SpellCheck check_apply() const = 0;
+
+  // Throwing form of check_apply for user commands. This method should
+  // throw user errors so that apply doesn't have to.
+  void verify_apply() const;
 
   // Apply should NEVER throw a User exception
   unsigned apply() const;
@@ -94,13 +132,15 @@ class Spell
   //
 
   virtual unsigned cost() const
-  { return DEFAULT_COST_FUNC(m_base_cost, m_spell_level); }
+  { return DEFAULT_COST_FUNC(m_prototype.m_base_cost, m_spell_level); }
 
-  const std::string& name() const { return m_name; }
+  SpellId id() const { return m_prototype.m_id; }
+
+  const std::string& name() const { return m_prototype.m_name; }
 
   virtual const char* info() const { return "TODO"; }
 
-  const SpellPrereq& prereq() const { return m_prereq; }
+  const SpellPrereq& prereq() const { return m_prototype.m_prereq; }
 
   unsigned level() const { return m_spell_level; }
 
@@ -112,22 +152,20 @@ class Spell
 
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const = 0;
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const = 0;
 
-  float compute_destructiveness(const WorldTile& tile, bool report) const;
+  // Land factors (see Factor) are left out unless with_land
+  float compute_destructiveness(const WorldTile& tile, bool report, bool with_land = true) const;
 
-  void verify_no_repeat_cast() const;
+  SpellCheck check_no_repeat_cast() const;
 
  protected:
 
   // Members
-  const std::string& m_name;
-  unsigned           m_spell_level;
-  Location           m_location;
-  unsigned           m_base_cost;
-  const SpellPrereq& m_prereq;
-  Engine&            m_engine;
-  SpellSpec          m_spec;
+  const SpellPrototype& m_prototype;
+  unsigned              m_spell_level;
+  Location              m_location;
+  Engine&               m_engine;
 
   // Constants
 
@@ -155,7 +193,7 @@ class Spell
   std::pair<unsigned,bool> kill(City& city, float kill_pct) const;
 
   // Returns exp gained
-  unsigned damage(LandTile& tile, float destructiveness, const base_factor_pair_t& spec, const std::string& name) const;
+  unsigned damage(LandTile& tile, float destructiveness, SpellSpecBase::Effect effect, const std::string& name) const;
 
   unsigned destroy(LandTile& tile, unsigned max_destroyed, const std::string& name,
                    std::function<unsigned(LandTile&)> const&  getter,
@@ -167,7 +205,7 @@ class Spell
   // Some disasters can trigger other disasters (chain reaction). This method
   // encompassed the implementation of this phenominon. The amount of exp
   // gained is returned.
-  unsigned trigger(const std::string& spell_name, unsigned spell_level) const;
+  unsigned trigger(SpellId spell_id, unsigned spell_level) const;
 };
 
 // TODO - Do we want spells for controlling all the basic properties
@@ -193,54 +231,53 @@ class Hot : public Spell
   Hot(unsigned        spell_level,
       const Location& location,
       Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-            SpellSpec {
-              // destructiveness
-              { {"temperature", [](WorldTile const& tile) -> float{
-                    return baal::poly_growth(tile.atmosphere().temperature(), 1.5, KILL_THRESHOLD, 8);
-                  } },
-                {"dewpoint", [](WorldTile const& tile) -> float{
-                    return 1.0;  // TODO
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return baal::sqrt(engine.ai_player().tech_level());
-                    } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // defense dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } ),
-    m_degrees_heated_land(
-      [](WorldTile const& tile, unsigned spell_level) -> unsigned{ return 7 * spell_level; }
-                          ),
-    m_degrees_heated_ocean(
-      [](WorldTile const& tile, unsigned spell_level) -> unsigned{ return 2 * spell_level; }
-                           )
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const;
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("temperature", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::poly_growth(tile.atmosphere().temperature(), 1.5, KILL_THRESHOLD, 8);
+                   }),
+                   factor("dewpoint", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return 1.0;  // TODO
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return baal::sqrt(engine.ai_player().tech_level());
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const;
 
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const;
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const;
 
-  std::function<unsigned(const WorldTile&, unsigned)> m_degrees_heated_land;
-  std::function<unsigned(const WorldTile&, unsigned)> m_degrees_heated_ocean;
+  static unsigned degrees_heated_land(WorldTile const& tile, unsigned spell_level)
+  { return 7 * spell_level; }
+  static unsigned degrees_heated_ocean(WorldTile const& tile, unsigned spell_level)
+  { return 2 * spell_level; }
 
   static constexpr unsigned BASE_COST = 50;
   static constexpr int KILL_THRESHOLD = 100;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = HOT_SPELL;
 };
 
 /**
@@ -259,58 +296,57 @@ class Cold : public Spell
   Cold(unsigned        spell_level,
        const Location& location,
        Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-            SpellSpec {
-              // destructiveness
-              { {"temperature", [](WorldTile const& tile) -> float{
-                    return baal::poly_growth(tile.atmosphere().temperature(), -KILL_THRESHOLD, 1.5, 8) ;
-                  } },
-                {"wind", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.02, tile.atmosphere().wind().m_speed, 40);
-                  } },
-                {"famine", [](WorldTile const& tile) -> float{
-                    return tile.city() != nullptr && tile.city()->famine() ? FAMINE_BONUS : 1.0;
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return engine.ai_player().tech_level();
-                    } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // defense dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } ),
-    m_degrees_cooled_land(
-      [](WorldTile const& tile, unsigned spell_level) -> unsigned{ return 7 * spell_level; }
-                          ),
-    m_degrees_cooled_ocean(
-      [](WorldTile const& tile, unsigned spell_level) -> unsigned{ return 2 * spell_level; }
-                           )
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const;
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("temperature", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::poly_growth(tile.atmosphere().temperature(), -KILL_THRESHOLD, 1.5, 8) ;
+                   }),
+                   factor("wind", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.02, tile.atmosphere().wind().m_speed, 40);
+                   }),
+                   factor("famine", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return tile.city() != nullptr && tile.city()->famine() ? FAMINE_BONUS : 1.0;
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return engine.ai_player().tech_level();
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const;
 
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const;
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const;
 
-  std::function<unsigned(const WorldTile&, unsigned)> m_degrees_cooled_land;
-  std::function<unsigned(const WorldTile&, unsigned)> m_degrees_cooled_ocean;
+  static unsigned degrees_cooled_land(WorldTile const& tile, unsigned spell_level)
+  { return 7 * spell_level; }
+  static unsigned degrees_cooled_ocean(WorldTile const& tile, unsigned spell_level)
+  { return 2 * spell_level; }
 
   static constexpr unsigned BASE_COST = 50;
   static constexpr int KILL_THRESHOLD = 0;
   static constexpr float FAMINE_BONUS = 2.0;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = COLD_SPELL;
 };
 
 /**
@@ -329,52 +365,54 @@ class Infect : public Spell
   Infect(unsigned        spell_level,
          const Location& location,
          Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-            SpellSpec {
-              // destructiveness
-              { {"spell power", [spell_level](WorldTile const& tile) -> float{
-                    return baal::poly_growth(spell_level, 1.3) ;
-                  } },
-                {"city size", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.05, tile.city()->rank()) ;
-                  } },
-                {"extreme temp", [](WorldTile const& tile) -> float{
-                    const int curr_temp = tile.atmosphere().temperature();
-                    if (curr_temp < COLD_THRESHOLD) {
-                      return baal::exp_growth(1.03, COLD_THRESHOLD - curr_temp);
-                    }
-                    else if (curr_temp > WARM_THRESHOLD) {
-                      return baal::exp_growth(1.03, curr_temp);
-                    }
-                    return 1.0;
-                  } },
-                {"famine", [](WorldTile const& tile) -> float{
-                    return tile.city()->famine() ? FAMINE_BONUS : 1.0;
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return engine.ai_player().tech_level();
-                    } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // defense dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } )
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const;
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("spell power", [](WorldTile const& tile, unsigned spell_level, Engine const&) -> float{
+                     return baal::poly_growth(spell_level, 1.3) ;
+                   }),
+                   factor("city size", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.05, tile.city()->rank()) ;
+                   }),
+                   factor("extreme temp", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     const int curr_temp = tile.atmosphere().temperature();
+                     if (curr_temp < COLD_THRESHOLD) {
+                       return baal::exp_growth(1.03, COLD_THRESHOLD - curr_temp);
+                     }
+                     else if (curr_temp > WARM_THRESHOLD) {
+                       return baal::exp_growth(1.03, curr_temp);
+                     }
+                     return 1.0;
+                   }),
+                   factor("famine", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return tile.city()->famine() ? FAMINE_BONUS : 1.0;
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return engine.ai_player().tech_level();
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const;
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const;
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const;
 
   static constexpr unsigned BASE_COST = 50;
   static constexpr float FAMINE_BONUS = 2.0;
@@ -382,6 +420,7 @@ class Infect : public Spell
   static constexpr int COLD_THRESHOLD = 30;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = INFECT_SPELL;
 };
 
 /**
@@ -401,56 +440,55 @@ class WindSpell : public Spell
   WindSpell(unsigned        spell_level,
             const Location& location,
             Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-            SpellSpec {
-              // destructiveness
-              { {"wind", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.03, tile.atmosphere().wind().m_speed, KILL_THRESHOLD);
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return baal::sqrt(engine.ai_player().tech_level());
-                  } },
-                {"defense", [](WorldTile const& tile) -> float {
-                    return baal::sqrt(tile.city()->defense());
-                  } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const& tile, float) -> float{
-                  return baal::exp_growth(1.03, tile.atmosphere().wind().m_speed, DAMAGE_THRESHOLD);
-                },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return baal::sqrt(engine.ai_player().tech_level());
-                    } } }
-              },
-                // defense dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } ),
-    m_wind_speedup(
-      [](WorldTile const& tile, unsigned spell_level) -> unsigned{ return 20 * spell_level; }
-                   )
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const;
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("wind", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.03, tile.atmosphere().wind().m_speed, KILL_THRESHOLD);
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return baal::sqrt(engine.ai_player().tech_level());
+                                  }),
+                                  factor("defense", [](WorldTile const& tile, unsigned, Engine const&) -> float {
+                                    return baal::sqrt(tile.city()->defense());
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const& tile, float) -> float{
+                       return baal::exp_growth(1.03, tile.atmosphere().wind().m_speed, DAMAGE_THRESHOLD);
+                     },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return baal::sqrt(engine.ai_player().tech_level());
+                                  }))),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const;
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const;
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const;
 
-  std::function<unsigned(const WorldTile&, unsigned)> m_wind_speedup;
+  static unsigned wind_speedup(WorldTile const& tile, unsigned spell_level)
+  { return 20 * spell_level; }
 
   static constexpr unsigned BASE_COST = 50;
   static constexpr unsigned DAMAGE_THRESHOLD = 60;
   static constexpr unsigned KILL_THRESHOLD = 80;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = WIND_SPELL;
 };
 
 /**
@@ -469,69 +507,67 @@ class Fire : public Spell
   Fire(unsigned        spell_level,
        const Location& location,
        Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-            SpellSpec {
-              // destructiveness
-              { {"spell power", [spell_level](WorldTile const& tile) -> float{
-                    return baal::poly_growth(spell_level, 1.3);
-                  } },
-                {"wind", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.05, tile.atmosphere().wind().m_speed, WIND_TIPPING_POINT, 30);
-                  } },
-                {"temperature", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.03, tile.atmosphere().temperature(), TEMP_TIPPING_POINT);
-                  } },
-                {"moisture", [](WorldTile const& tile) -> float{
-                    const float pct_beyond_dry = (MOISTURE_TIPPING_POINT - dynamic_cast<FoodTile const&>(tile).soil_moisture()) * 100;
-                    return baal::exp_growth(1.05, pct_beyond_dry, 40);
-                  } },
-                {"dewpoint", [](WorldTile const& tile) -> float{
-                    return 1.0; // TODO
-                  } },
-                {"snowpack", [](WorldTile const& tile) -> float{
-                    return 1 / baal::exp_growth(1.1, tile.snowpack());
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{
-                  return baal::linear_growth(destructiveness, 0, 1.0);
-                },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return baal::sqrt(engine.ai_player().tech_level());
-                  } },
-                {"defense", [](WorldTile const& tile) -> float {
-                    return baal::sqrt(tile.city()->defense());
-                  } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float destructiveness) -> float{
-                  return baal::exp_growth(1.05, destructiveness);
-                },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return baal::sqrt(engine.ai_player().tech_level());
-                    } } }
-              },
-                // defense dmg spec
-              { [](WorldTile const&, float destructiveness) -> float{
-                  return baal::exp_growth(1.03, destructiveness);
-                },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return baal::sqrt(engine.ai_player().tech_level());
-                    } } }
-              },
-                // tile dmg spec
-                [](WorldTile const&, float destructiveness) -> float{ return destructiveness; } } )
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const;
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("spell power", [](WorldTile const& tile, unsigned spell_level, Engine const&) -> float{
+                     return baal::poly_growth(spell_level, 1.3);
+                   }),
+                   factor("wind", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.05, tile.atmosphere().wind().m_speed, WIND_TIPPING_POINT, 30);
+                   }),
+                   factor("temperature", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.03, tile.atmosphere().temperature(), TEMP_TIPPING_POINT);
+                   }),
+                   land_factor("moisture", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     const float pct_beyond_dry = (MOISTURE_TIPPING_POINT - dynamic_cast<FoodTile const&>(tile).soil_moisture()) * 100;
+                     return baal::exp_growth(1.05, pct_beyond_dry, 40);
+                   }),
+                   factor("dewpoint", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return 1.0; // TODO
+                   }),
+                   factor("snowpack", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return 1 / baal::exp_growth(1.1, tile.snowpack());
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{
+                       return baal::linear_growth(destructiveness, 0, 1.0);
+                     },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return baal::sqrt(engine.ai_player().tech_level());
+                                  }),
+                                  factor("defense", [](WorldTile const& tile, unsigned, Engine const&) -> float {
+                                    return baal::sqrt(tile.city()->defense());
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{
+                       return baal::exp_growth(1.05, destructiveness);
+                     },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return baal::sqrt(engine.ai_player().tech_level());
+                                  }))),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{
+                       return baal::exp_growth(1.03, destructiveness);
+                     },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return baal::sqrt(engine.ai_player().tech_level());
+                                  }))),
+      // tile dmg spec
+      [](WorldTile const&, float destructiveness) -> float{ return destructiveness; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const;
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const;
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const;
 
   static constexpr unsigned BASE_COST = 100;
   static constexpr int TEMP_TIPPING_POINT = 75;
@@ -544,6 +580,7 @@ class Fire : public Spell
 
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = FIRE_SPELL;
 };
 
 /**
@@ -563,62 +600,55 @@ class Tstorm : public Spell
   Tstorm(unsigned        spell_level,
          const Location& location,
          Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-            SpellSpec {
-              // destructiveness
-              { {"spell power", [spell_level](WorldTile const& tile) -> float{
-                    return spell_level;
-                  } },
-                {"wind", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.03, tile.atmosphere().wind().m_speed, WIND_TIPPING_POINT);
-                  } },
-                {"temperature", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.03, tile.atmosphere().temperature(), TEMP_TIPPING_POINT);
-                  } },
-                {"pressure", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.05, tile.atmosphere().pressure(), PRESSURE_TIPPING_POINT);
-                  } },
-                {"dewpoint", [](WorldTile const& tile) -> float{
-                    return 1.0; // TODO
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{
-                  return destructiveness / 5.0;
-                },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return baal::sqrt(engine.ai_player().tech_level());
-                  } },
-                {"defense", [](WorldTile const& tile) -> float {
-                    return baal::sqrt(tile.city()->defense());
-                  } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // defense dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } ),
-    m_wind_spawn_func( [](float destructiveness) -> unsigned{
-        return baal::fibonacci_div(destructiveness, WIND_DESTRUCTIVENESS_THRESHOLD);
-      }),
-    m_flood_spawn_func( [](float destructiveness) -> unsigned{
-        return baal::fibonacci_div(destructiveness, FLOOD_DESTRUCTIVENESS_THRESHOLD);
-      }),
-    m_tornado_spawn_func( [](float destructiveness) -> unsigned{
-        return baal::fibonacci_div(destructiveness, TORNADO_DESTRUCTIVENESS_THRESHOLD);
-      })
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const;
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("spell power", [](WorldTile const& tile, unsigned spell_level, Engine const&) -> float{
+                     return spell_level;
+                   }),
+                   factor("wind", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.03, tile.atmosphere().wind().m_speed, WIND_TIPPING_POINT);
+                   }),
+                   factor("temperature", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.03, tile.atmosphere().temperature(), TEMP_TIPPING_POINT);
+                   }),
+                   factor("pressure", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.05, tile.atmosphere().pressure(), PRESSURE_TIPPING_POINT);
+                   }),
+                   factor("dewpoint", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return 1.0; // TODO
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{
+                       return destructiveness / 5.0;
+                     },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return baal::sqrt(engine.ai_player().tech_level());
+                                  }),
+                                  factor("defense", [](WorldTile const& tile, unsigned, Engine const&) -> float {
+                                    return baal::sqrt(tile.city()->defense());
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const;
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const;
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const;
 
   static constexpr unsigned BASE_COST = 100;
   static constexpr int TEMP_TIPPING_POINT = 85;
@@ -634,10 +664,14 @@ class Tstorm : public Spell
 
   static const SpellPrereq PREREQ;
   static const std::string NAME;
-
-  std::function<unsigned(float destructiveness)> m_wind_spawn_func;
-  std::function<unsigned(float destructiveness)> m_flood_spawn_func;
-  std::function<unsigned(float destructiveness)> m_tornado_spawn_func;
+  static constexpr SpellId ID = TSTORM_SPELL;
+
+  static unsigned wind_spawn_func(float destructiveness)
+  { return baal::fibonacci_div(destructiveness, WIND_DESTRUCTIVENESS_THRESHOLD); }
+  static unsigned flood_spawn_func(float destructiveness)
+  { return baal::fibonacci_div(destructiveness, FLOOD_DESTRUCTIVENESS_THRESHOLD); }
+  static unsigned tornado_spawn_func(float destructiveness)
+  { return baal::fibonacci_div(destructiveness, TORNADO_DESTRUCTIVENESS_THRESHOLD); }
 };
 
 /**
@@ -655,55 +689,56 @@ class Snow : public Spell
   Snow(unsigned        spell_level,
        const Location& location,
        Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-            SpellSpec {
-              // destructiveness
-              { {"spell power", [spell_level](WorldTile const& tile) -> float{
-                    return spell_level * 4;
-                  } },
-                {"pressure", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.05, Atmosphere::NORMAL_PRESSURE - tile.atmosphere().pressure());
-                  } },
-                {"temperature", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.03, MAX_TEMP - tile.atmosphere().temperature(), 0, 15);
-                  } },
-                {"dewpoint", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.05, tile.atmosphere().dewpoint(), 20);
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{ return destructiveness / 4; },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                      return baal::poly_growth(engine.ai_player().tech_level(), 0.5);
-                    } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // defense dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } ),
-    m_snowfall_func( [](float destructiveness) -> unsigned{
-        return destructiveness * 4;
-      })
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const;
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("spell power", [](WorldTile const& tile, unsigned spell_level, Engine const&) -> float{
+                     return spell_level * 4;
+                   }),
+                   factor("pressure", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.05, Atmosphere::NORMAL_PRESSURE - tile.atmosphere().pressure());
+                   }),
+                   factor("temperature", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.03, MAX_TEMP - tile.atmosphere().temperature(), 0, 15);
+                   }),
+                   factor("dewpoint", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.05, tile.atmosphere().dewpoint(), 20);
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{ return destructiveness / 4; },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return baal::poly_growth(engine.ai_player().tech_level(), 0.5);
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const;
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const;
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const;
 
   static constexpr unsigned BASE_COST = 100;
   static constexpr int MAX_TEMP = 35;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = SNOW_SPELL;
 
-  std::function<unsigned(float destructiveness)> m_snowfall_func;
+  static unsigned snowfall_func(float destructiveness)
+  { return destructiveness * 4; }
 };
 
 /**
@@ -721,73 +756,70 @@ class Flood : public Spell
   Flood(unsigned        spell_level,
         const Location& location,
         Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-            SpellSpec {
-              // destructiveness
-              { {"spell power", [spell_level](WorldTile const& tile) -> float{
-                    return spell_level ;
-                  } },
-                {"dewpoint", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.03, tile.atmosphere().dewpoint(), 55);
-                  } },
-                {"pressure", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.03, tile.atmosphere().pressure(), Atmosphere::NORMAL_PRESSURE);
-                  } },
-                {"moisture", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.05, tile.soil_moisture() * 10, 10);
-                  } },
-                {"elevation", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.1, tile.elevation() / 500.0);
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                      return baal::sqrt(engine.ai_player().tech_level());
-                    } },
-                {"defense", [](WorldTile const& tile) -> float {
-                    return tile.city()->defense();
-                  } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float destructiveness) -> float{
-                  return baal::exp_growth(1.05, destructiveness);
-                },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return baal::sqrt(engine.ai_player().tech_level());
-                    } } }
-              },
-                // defense dmg spec
-              { [](WorldTile const&, float destructiveness) -> float{
-                  return baal::exp_growth(1.03, destructiveness);
-                },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return baal::sqrt(engine.ai_player().tech_level());
-                    } } }
-              },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } ),
-    m_rainfall_func( [](float destructiveness) -> float{
-        return destructiveness;
-      })
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const;
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("spell power", [](WorldTile const& tile, unsigned spell_level, Engine const&) -> float{
+                     return spell_level ;
+                   }),
+                   factor("dewpoint", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.03, tile.atmosphere().dewpoint(), 55);
+                   }),
+                   factor("pressure", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.03, tile.atmosphere().pressure(), Atmosphere::NORMAL_PRESSURE);
+                   }),
+                   land_factor("moisture", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.05, tile.soil_moisture() * 10, 10);
+                   }),
+                   land_factor("elevation", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.1, tile.elevation() / 500.0);
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return baal::sqrt(engine.ai_player().tech_level());
+                                  }),
+                                  factor("defense", [](WorldTile const& tile, unsigned, Engine const&) -> float {
+                                    return tile.city()->defense();
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{
+                       return baal::exp_growth(1.05, destructiveness);
+                     },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return baal::sqrt(engine.ai_player().tech_level());
+                                  }))),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{
+                       return baal::exp_growth(1.03, destructiveness);
+                     },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return baal::sqrt(engine.ai_player().tech_level());
+                                  }))),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const;
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const;
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const;
 
   static constexpr unsigned BASE_COST = 200;
   static constexpr int MIN_TEMP = 40;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = FLOOD_SPELL;
 
-  std::function<float(float destructiveness)> m_rainfall_func;
+  static float rainfall_func(float destructiveness)
+  { return destructiveness; }
 };
 
 /**
@@ -805,60 +837,61 @@ class Dry : public Spell
   Dry(unsigned        spell_level,
       const Location& location,
       Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-            SpellSpec {
-              // destructiveness
-              { {"spell power", [spell_level](WorldTile const& tile) -> float{
-                    return spell_level / 10.0;
-                  } },
-                {"dewpoint", [](WorldTile const& tile) -> float{
-                    return 1.0;  // TODO
-                  } },
-                {"temperature", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.01, tile.atmosphere().temperature(), TEMP_TIPPING_POINT);
-                  } },
-                {"moisture", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.05, (1.0 - tile.soil_moisture()) * 10, 1);
-                  } },
-                {"pressure", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.0, tile.atmosphere().pressure(), PRESSURE_TIPPING_POINT);
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return engine.ai_player().tech_level();
-                    } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // defense dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } ),
-    m_moisture_reduction_fraction_func( [](float destructiveness) -> float{
-        return baal::exp_growth(.9, destructiveness * 10);
-      })
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const;
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("spell power", [](WorldTile const& tile, unsigned spell_level, Engine const&) -> float{
+                     return spell_level / 10.0;
+                   }),
+                   factor("dewpoint", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return 1.0;  // TODO
+                   }),
+                   factor("temperature", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.01, tile.atmosphere().temperature(), TEMP_TIPPING_POINT);
+                   }),
+                   land_factor("moisture", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.05, (1.0 - tile.soil_moisture()) * 10, 1);
+                   }),
+                   factor("pressure", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.0, tile.atmosphere().pressure(), PRESSURE_TIPPING_POINT);
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return engine.ai_player().tech_level();
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const;
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const;
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const;
 
   static constexpr unsigned BASE_COST = 200;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = DRY_SPELL;
 
   static constexpr int TEMP_TIPPING_POINT = 75;
   static constexpr unsigned PRESSURE_TIPPING_POINT = Atmosphere::NORMAL_PRESSURE;
 
-  std::function<float(float destructiveness)> m_moisture_reduction_fraction_func;;
+  static float moisture_reduction_fraction_func(float destructiveness)
+  { return baal::exp_growth(.9, destructiveness * 10); }
 };
 
 /**
@@ -875,58 +908,59 @@ class Blizzard : public Spell
   Blizzard(unsigned        spell_level,
            const Location& location,
            Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-            SpellSpec {
-              // destructiveness
-              { {"spell power", [spell_level](WorldTile const& tile) -> float{
-                    return spell_level * 8;
-                  } },
-                {"pressure", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.05, Atmosphere::NORMAL_PRESSURE - tile.atmosphere().pressure());
-                  } },
-                {"temperature", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.03, MAX_TEMP - tile.atmosphere().temperature(), 0, 15);
-                  } },
-                {"wind", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.01, tile.atmosphere().wind().m_speed);
-                  } },
-                {"dewpoint", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.05, tile.atmosphere().dewpoint(), 20);
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return engine.ai_player().tech_level();
-                    } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // defense dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } ),
-    m_snowfall_func( [](float destructiveness) -> unsigned{
-        return destructiveness * 4;
-      })
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const;
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("spell power", [](WorldTile const& tile, unsigned spell_level, Engine const&) -> float{
+                     return spell_level * 8;
+                   }),
+                   factor("pressure", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.05, Atmosphere::NORMAL_PRESSURE - tile.atmosphere().pressure());
+                   }),
+                   factor("temperature", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.03, MAX_TEMP - tile.atmosphere().temperature(), 0, 15);
+                   }),
+                   factor("wind", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.01, tile.atmosphere().wind().m_speed);
+                   }),
+                   factor("dewpoint", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.05, tile.atmosphere().dewpoint(), 20);
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return engine.ai_player().tech_level();
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const;
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const;
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const;
 
   static constexpr unsigned BASE_COST = 200;
   static constexpr int MAX_TEMP = 35;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = BLIZZARD_SPELL;
 
-  std::function<unsigned(float destructiveness)> m_snowfall_func;
+  static unsigned snowfall_func(float destructiveness)
+  { return destructiveness * 4; }
 };
 
 /**
@@ -943,67 +977,66 @@ class Avalanche : public Spell
   Avalanche(unsigned        spell_level,
             const Location& location,
             Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-            SpellSpec {
-              // destructiveness
-              { {"spell power", [spell_level](WorldTile const& tile) -> float{
-                    return baal::poly_growth(spell_level, 1.3) ;
-                  } },
-                {"ongoing snowstorm", [](WorldTile const& tile) -> float{
-                    return tile.already_casted(Snow::NAME) ? 1.5 : 1;
-                  } },
-                {"ongoing blizzard", [](WorldTile const& tile) -> float{
-                    return tile.already_casted(Blizzard::NAME) ? 2 : 1;
-                  } },
-                {"elevation", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.1, tile.elevation() / 1000.0, 2.0);
-                  } },
-                {"snowpack", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.002, tile.snowpack(), 100);
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                      return baal::sqrt(engine.ai_player().tech_level());
-                    } },
-                {"defense", [](WorldTile const& tile) -> float {
-                    return baal::sqrt(tile.city()->defense());
-                  } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float destructiveness) -> float{
-                  return baal::exp_growth(1.05, destructiveness);
-                },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return baal::sqrt(engine.ai_player().tech_level());
-                    } } }
-              },
-                // defense dmg spec
-              { [](WorldTile const&, float destructiveness) -> float{
-                  return baal::exp_growth(1.03, destructiveness);
-                },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return baal::sqrt(engine.ai_player().tech_level());
-                    } } }
-              },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } )
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const;
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("spell power", [](WorldTile const& tile, unsigned spell_level, Engine const&) -> float{
+                     return baal::poly_growth(spell_level, 1.3) ;
+                   }),
+                   factor("ongoing snowstorm", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return tile.already_casted(Snow::ID) ? 1.5 : 1;
+                   }),
+                   factor("ongoing blizzard", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return tile.already_casted(Blizzard::ID) ? 2 : 1;
+                   }),
+                   land_factor("elevation", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.1, tile.elevation() / 1000.0, 2.0);
+                   }),
+                   factor("snowpack", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.002, tile.snowpack(), 100);
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return baal::sqrt(engine.ai_player().tech_level());
+                                  }),
+                                  factor("defense", [](WorldTile const& tile, unsigned, Engine const&) -> float {
+                                    return baal::sqrt(tile.city()->defense());
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{
+                       return baal::exp_growth(1.05, destructiveness);
+                     },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return baal::sqrt(engine.ai_player().tech_level());
+                                  }))),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{
+                       return baal::exp_growth(1.03, destructiveness);
+                     },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return baal::sqrt(engine.ai_player().tech_level());
+                                  }))),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const;
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const;
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const;
 
   static constexpr unsigned BASE_COST = 200;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = AVALANCHE_SPELL;
 };
 
 /**
@@ -1021,57 +1054,60 @@ class Tornado : public Spell
   Tornado(unsigned        spell_level,
           const Location& location,
           Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-            SpellSpec {
-              // destructiveness
-              { {"spell power", [spell_level](WorldTile const& tile) -> float{
-                    return spell_level;
-                  } },
-                {"wind", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.03, tile.atmosphere().wind().m_speed, WIND_TIPPING_POINT);
-                  } },
-                {"temperature", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.03, tile.atmosphere().temperature(), TEMP_TIPPING_POINT);
-                  } },
-                {"pressure", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(1.05, tile.atmosphere().pressure(), PRESSURE_TIPPING_POINT);
-                  } },
-                {"dewpoint", [](WorldTile const& tile) -> float{
-                    return 1.0; // TODO
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{
-                  return destructiveness / 5.0;
-                },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return baal::sqrt(engine.ai_player().tech_level());
-                  } },
-                {"defense", [](WorldTile const& tile) -> float {
-                    return baal::sqrt(tile.city()->defense());
-                  } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // defense dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } )
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const;
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("spell power", [](WorldTile const& tile, unsigned spell_level, Engine const&) -> float{
+                     return spell_level;
+                   }),
+                   factor("wind", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.03, tile.atmosphere().wind().m_speed, WIND_TIPPING_POINT);
+                   }),
+                   factor("temperature", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.03, tile.atmosphere().temperature(), TEMP_TIPPING_POINT);
+                   }),
+                   factor("pressure", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(1.05, tile.atmosphere().pressure(), PRESSURE_TIPPING_POINT);
+                   }),
+                   factor("dewpoint", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return 1.0; // TODO
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{
+                       return destructiveness / 5.0;
+                     },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return baal::sqrt(engine.ai_player().tech_level());
+                                  }),
+                                  factor("defense", [](WorldTile const& tile, unsigned, Engine const&) -> float {
+                                    return baal::sqrt(tile.city()->defense());
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const;
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const;
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const;
 
   static constexpr unsigned BASE_COST = 200;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = TORNADO_SPELL;
   static constexpr float DRY_STORM_MOISTURE_ADD = .1;
 
   static constexpr int TEMP_TIPPING_POINT = 85;
@@ -1093,46 +1129,49 @@ class Heatwave : public Spell
   Heatwave(unsigned        spell_level,
            const Location& location,
            Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-                        SpellSpec {
-              // destructiveness
-              { {"spell power", [spell_level](WorldTile const& tile) -> float{
-                    return baal::poly_growth(spell_level, 0.0, 1.3) ;
-                  } },
-                {"city size", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
-                  } },
-                {"famine", [](WorldTile const& tile) -> float{
-                    return tile.city()->famine() ? 0.0 : 1.0;
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return engine.ai_player().tech_level();
-                    } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // defense dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } )
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const { /*TODO*/ }
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("spell power", [](WorldTile const& tile, unsigned spell_level, Engine const&) -> float{
+                     return baal::poly_growth(spell_level, 0.0, 1.3) ;
+                   }),
+                   factor("city size", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
+                   }),
+                   factor("famine", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return tile.city()->famine() ? 0.0 : 1.0;
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return engine.ai_player().tech_level();
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const { return SpellCheck(); /*TODO*/ }
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const {}
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const {}
 
   static constexpr unsigned BASE_COST = 400;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = HEATWAVE_SPELL;
 };
 
 /**
@@ -1149,46 +1188,49 @@ class Coldwave : public Spell
   Coldwave(unsigned        spell_level,
            const Location& location,
            Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-                        SpellSpec {
-              // destructiveness
-              { {"spell power", [spell_level](WorldTile const& tile) -> float{
-                    return baal::poly_growth(spell_level, 0.0, 1.3) ;
-                  } },
-                {"city size", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
-                  } },
-                {"famine", [](WorldTile const& tile) -> float{
-                    return tile.city()->famine() ? 0.0 : 1.0;
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return engine.ai_player().tech_level();
-                    } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // defense dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } )
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const { /*TODO*/ }
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("spell power", [](WorldTile const& tile, unsigned spell_level, Engine const&) -> float{
+                     return baal::poly_growth(spell_level, 0.0, 1.3) ;
+                   }),
+                   factor("city size", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
+                   }),
+                   factor("famine", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return tile.city()->famine() ? 0.0 : 1.0;
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return engine.ai_player().tech_level();
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const { return SpellCheck(); /*TODO*/ }
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const {}
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const {}
 
   static constexpr unsigned BASE_COST = 400;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = COLDWAVE_SPELL;
 };
 
 /**
@@ -1205,46 +1247,49 @@ class Drought : public Spell
   Drought(unsigned        spell_level,
           const Location& location,
           Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-                        SpellSpec {
-              // destructiveness
-              { {"spell power", [spell_level](WorldTile const& tile) -> float{
-                    return baal::poly_growth(spell_level, 0.0, 1.3) ;
-                  } },
-                {"city size", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
-                  } },
-                {"famine", [](WorldTile const& tile) -> float{
-                    return tile.city()->famine() ? 0.0 : 1.0;
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return engine.ai_player().tech_level();
-                    } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // defense dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } )
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const { /*TODO*/ }
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("spell power", [](WorldTile const& tile, unsigned spell_level, Engine const&) -> float{
+                     return baal::poly_growth(spell_level, 0.0, 1.3) ;
+                   }),
+                   factor("city size", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
+                   }),
+                   factor("famine", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return tile.city()->famine() ? 0.0 : 1.0;
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return engine.ai_player().tech_level();
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const { return SpellCheck(); /*TODO*/ }
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const {}
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const {}
 
   static constexpr unsigned BASE_COST = 400;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = DROUGHT_SPELL;
 };
 
 /**
@@ -1261,46 +1306,49 @@ class Monsoon : public Spell
   Monsoon(unsigned        spell_level,
           const Location& location,
           Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-                        SpellSpec {
-              // destructiveness
-              { {"spell power", [spell_level](WorldTile const& tile) -> float{
-                    return baal::poly_growth(spell_level, 0.0, 1.3) ;
-                  } },
-                {"city size", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
-                  } },
-                {"famine", [](WorldTile const& tile) -> float{
-                    return tile.city()->famine() ? 0.0 : 1.0;
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return engine.ai_player().tech_level();
-                    } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // defense dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } )
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const { /*TODO*/ }
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("spell power", [](WorldTile const& tile, unsigned spell_level, Engine const&) -> float{
+                     return baal::poly_growth(spell_level, 0.0, 1.3) ;
+                   }),
+                   factor("city size", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
+                   }),
+                   factor("famine", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return tile.city()->famine() ? 0.0 : 1.0;
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return engine.ai_player().tech_level();
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const { return SpellCheck(); /*TODO*/ }
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const {}
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const {}
 
   static constexpr unsigned BASE_COST = 400;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = MONSOON_SPELL;
 };
 
 /**
@@ -1316,56 +1364,59 @@ class Disease : public Spell
   Disease(unsigned        spell_level,
           const Location& location,
           Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-                        SpellSpec {
-              // destructiveness
-              { {"spell power", [spell_level](WorldTile const& tile) -> float{
-                    return baal::poly_growth(spell_level, 0.0, 1.3) ;
-                  } },
-                {"city size", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
-                  } },
-                {"extreme temp", [](WorldTile const& tile) -> float{
-                    const int curr_temp = tile.atmosphere().temperature();
-                    if (curr_temp < 0) {
-                      return baal::exp_growth(-curr_temp, 0, 1.03);
-                    }
-                    else if (curr_temp > 90) {
-                      return baal::exp_growth(curr_temp - 90, 0, 1.03);
-                    }
-                    return 1.0;
-                  } },
-                {"famine", [](WorldTile const& tile) -> float{
-                    return tile.city()->famine() ? 0.0 : 1.0;
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return engine.ai_player().tech_level();
-                    } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // defense dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } )
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const { /*TODO*/ }
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("spell power", [](WorldTile const& tile, unsigned spell_level, Engine const&) -> float{
+                     return baal::poly_growth(spell_level, 0.0, 1.3) ;
+                   }),
+                   factor("city size", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
+                   }),
+                   factor("extreme temp", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     const int curr_temp = tile.atmosphere().temperature();
+                     if (curr_temp < 0) {
+                       return baal::exp_growth(-curr_temp, 0, 1.03);
+                     }
+                     else if (curr_temp > 90) {
+                       return baal::exp_growth(curr_temp - 90, 0, 1.03);
+                     }
+                     return 1.0;
+                   }),
+                   factor("famine", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return tile.city()->famine() ? 0.0 : 1.0;
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return engine.ai_player().tech_level();
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const { return SpellCheck(); /*TODO*/ }
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const {}
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const {}
 
   static constexpr unsigned BASE_COST = 800;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = DISEASE_SPELL;
 };
 
 /**
@@ -1382,46 +1433,49 @@ class Earthquake : public Spell
   Earthquake(unsigned        spell_level,
              const Location& location,
              Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-                        SpellSpec {
-              // destructiveness
-              { {"spell power", [spell_level](WorldTile const& tile) -> float{
-                    return baal::poly_growth(spell_level, 0.0, 1.3) ;
-                  } },
-                {"city size", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
-                  } },
-                {"famine", [](WorldTile const& tile) -> float{
-                    return tile.city()->famine() ? 0.0 : 1.0;
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return engine.ai_player().tech_level();
-                    } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // defense dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } )
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const { /*TODO*/ }
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("spell power", [](WorldTile const& tile, unsigned spell_level, Engine const&) -> float{
+                     return baal::poly_growth(spell_level, 0.0, 1.3) ;
+                   }),
+                   factor("city size", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
+                   }),
+                   factor("famine", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return tile.city()->famine() ? 0.0 : 1.0;
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return engine.ai_player().tech_level();
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const { return SpellCheck(); /*TODO*/ }
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const {}
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const {}
 
   static constexpr unsigned BASE_COST = 800;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = EARTHQUAKE_SPELL;
 };
 
 /**
@@ -1440,46 +1494,49 @@ class Hurricane : public Spell
   Hurricane(unsigned        spell_level,
             const Location& location,
             Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-                        SpellSpec {
-              // destructiveness
-              { {"spell power", [spell_level](WorldTile const& tile) -> float{
-                    return baal::poly_growth(spell_level, 0.0, 1.3) ;
-                  } },
-                {"city size", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
-                  } },
-                {"famine", [](WorldTile const& tile) -> float{
-                    return tile.city()->famine() ? 0.0 : 1.0;
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return engine.ai_player().tech_level();
-                    } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // defense dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } )
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const { /*TODO*/ }
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("spell power", [](WorldTile const& tile, unsigned spell_level, Engine const&) -> float{
+                     return baal::poly_growth(spell_level, 0.0, 1.3) ;
+                   }),
+                   factor("city size", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
+                   }),
+                   factor("famine", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return tile.city()->famine() ? 0.0 : 1.0;
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return engine.ai_player().tech_level();
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const { return SpellCheck(); /*TODO*/ }
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const {}
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const {}
 
   static constexpr unsigned BASE_COST = 800;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = HURRICANE_SPELL;
 };
 
 /**
@@ -1495,46 +1552,49 @@ class Plague : public Spell
   Plague(unsigned        spell_level,
          const Location& location,
          Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-                        SpellSpec {
-              // destructiveness
-              { {"spell power", [spell_level](WorldTile const& tile) -> float{
-                    return baal::poly_growth(spell_level, 0.0, 1.3) ;
-                  } },
-                {"city size", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
-                  } },
-                {"famine", [](WorldTile const& tile) -> float{
-                    return tile.city()->famine() ? 0.0 : 1.0;
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return engine.ai_player().tech_level();
-                    } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // defense dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } )
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const { /*TODO*/ }
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("spell power", [](WorldTile const& tile, unsigned spell_level, Engine const&) -> float{
+                     return baal::poly_growth(spell_level, 0.0, 1.3) ;
+                   }),
+                   factor("city size", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
+                   }),
+                   factor("famine", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return tile.city()->famine() ? 0.0 : 1.0;
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return engine.ai_player().tech_level();
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const { return SpellCheck(); /*TODO*/ }
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const {}
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const {}
 
   static constexpr unsigned BASE_COST = 1600;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = PLAGUE_SPELL;
 };
 
 /**
@@ -1551,46 +1611,49 @@ class Volcano : public Spell
   Volcano(unsigned        spell_level,
           const Location& location,
           Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-                        SpellSpec {
-              // destructiveness
-              { {"spell power", [spell_level](WorldTile const& tile) -> float{
-                    return baal::poly_growth(spell_level, 0.0, 1.3) ;
-                  } },
-                {"city size", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
-                  } },
-                {"famine", [](WorldTile const& tile) -> float{
-                    return tile.city()->famine() ? 0.0 : 1.0;
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return engine.ai_player().tech_level();
-                    } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // defense dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } )
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const { /*TODO*/ }
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("spell power", [](WorldTile const& tile, unsigned spell_level, Engine const&) -> float{
+                     return baal::poly_growth(spell_level, 0.0, 1.3) ;
+                   }),
+                   factor("city size", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
+                   }),
+                   factor("famine", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return tile.city()->famine() ? 0.0 : 1.0;
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return engine.ai_player().tech_level();
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const { return SpellCheck(); /*TODO*/ }
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const {}
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const {}
 
   static constexpr unsigned BASE_COST = 1600;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = VOLCANO_SPELL;
 };
 
 /**
@@ -1606,46 +1669,49 @@ class Asteroid : public Spell
   Asteroid(unsigned        spell_level,
            const Location& location,
            Engine&         engine)
-    : Spell(NAME,
-            spell_level,
-            location,
-            BASE_COST,
-            PREREQ,
-            engine,
-                        SpellSpec {
-              // destructiveness
-              { {"spell power", [spell_level](WorldTile const& tile) -> float{
-                    return baal::poly_growth(spell_level, 0.0, 1.3) ;
-                  } },
-                {"city size", [](WorldTile const& tile) -> float{
-                    return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
-                  } },
-                {"famine", [](WorldTile const& tile) -> float{
-                    return tile.city()->famine() ? 0.0 : 1.0;
-                  } }
-              },
-                // kill spec
-              { [](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
-                { {"tech level", [&engine](WorldTile const& tile) -> float {
-                    return engine.ai_player().tech_level();
-                    } } }
-              },
-                // infra dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // defense dmg spec
-              { [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; }, {} },
-                // tile dmg spec
-                [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; } } )
+    : Spell(prototype(), spell_level, location, engine)
   {}
 
-  virtual void verify_apply() const { /*TODO*/ }
+  static const SpellPrototype& prototype()
+  {
+    static const auto SPEC = make_spell_spec(
+      // destructiveness
+      make_factors(factor("spell power", [](WorldTile const& tile, unsigned spell_level, Engine const&) -> float{
+                     return baal::poly_growth(spell_level, 0.0, 1.3) ;
+                   }),
+                   factor("city size", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return baal::exp_growth(tile.city()->rank(), 0.0, 1.05) ;
+                   }),
+                   factor("famine", [](WorldTile const& tile, unsigned, Engine const&) -> float{
+                     return tile.city()->famine() ? 0.0 : 1.0;
+                   })),
+      // kill spec
+      make_mitigated([](WorldTile const&, float destructiveness) -> float{ return destructiveness; },
+                     make_factors(factor("tech level", [](WorldTile const& tile, unsigned, Engine const& engine) -> float {
+                                    return engine.ai_player().tech_level();
+                                  }))),
+      // infra dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // defense dmg spec
+      make_mitigated([](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; },
+                     make_factors()),
+      // tile dmg spec
+      [](WorldTile const&, float) -> float{ return DOES_NOT_APPLY; });
+
+    static const SpellPrototype PROTOTYPE {ID, NAME, BASE_COST, PREREQ, SPEC};
+    return PROTOTYPE;
+  }
+
+  virtual SpellCheck check_apply() const { return SpellCheck(); /*TODO*/ }
   virtual void apply_to_world(WorldTile& tile,
                               std::vector<WorldTile*>& affected_tiles,
-                              std::vector<std::pair<std::string, unsigned>>& triggered) const {}
+                              std::vector<std::pair<SpellId, unsigned>>& triggered) const {}
 
   static constexpr unsigned BASE_COST = 3200;
   static const SpellPrereq PREREQ;
   static const std::string NAME;
+  static constexpr SpellId ID = ASTEROID_SPELL;
 };
 
 }
@@ -4,6 +4,8 @@
 
 namespace baal {
 
+constexpr unsigned SpellFactory::HASH_TABLE_SIZE;
+
 std::string SpellFactory::ALL_SPELLS[] = {
   Hot::NAME,
   Cold::NAME,
@@ -31,102 +33,198 @@ std::string SpellFactory::ALL_SPELLS[] = {
 
 ///////////////////////////////////////////////////////////////////////////////
 std::shared_ptr<const Spell>
-SpellFactory::create_spell(const std::string& spell_name,
+SpellFactory::create_spell(SpellId            spell_id,
                            Engine&            engine,
                            unsigned           spell_level,
                            const Location&    location)
 ///////////////////////////////////////////////////////////////////////////////
 {
   Spell* new_spell = nullptr;
-  if (spell_name == Hot::NAME) {
+  switch (spell_id) {
+  case HOT_SPELL:
     new_spell = new Hot(spell_level, location, engine);
-  }
-  else if (spell_name == Cold::NAME) {
+    break;
+  case COLD_SPELL:
     new_spell = new Cold(spell_level, location, engine);
-  }
-  else if (spell_name == WindSpell::NAME) {
+    break;
+  case WIND_SPELL:
     new_spell = new WindSpell(spell_level, location, engine);
-  }
-  else if (spell_name == Infect::NAME) {
+    break;
+  case INFECT_SPELL:
     new_spell = new Infect(spell_level, location, engine);
-  }
-  else if (spell_name == Fire::NAME) {
+    break;
+  case FIRE_SPELL:
     new_spell = new Fire(spell_level, location, engine);
-  }
-  else if (spell_name == Tstorm::NAME) {
+    break;
+  case TSTORM_SPELL:
     new_spell = new Tstorm(spell_level, location, engine);
-  }
-  else if (spell_name == Snow::NAME) {
+    break;
+  case SNOW_SPELL:
     new_spell = new Snow(spell_level, location, engine);
-  }
-  else if (spell_name == Avalanche::NAME) {
+    break;
+  case AVALANCHE_SPELL:
     new_spell = new Avalanche(spell_level, location, engine);
-  }
-  else if (spell_name == Flood::NAME) {
+    break;
+  case FLOOD_SPELL:
     new_spell = new Flood(spell_level, location, engine);
-  }
-  else if (spell_name == Dry::NAME) {
+    break;
+  case DRY_SPELL:
     new_spell = new Dry(spell_level, location, engine);
-  }
-  else if (spell_name == Blizzard::NAME) {
+    break;
+  case BLIZZARD_SPELL:
     new_spell = new Blizzard(spell_level, location, engine);
-  }
-  else if (spell_name == Tornado::NAME) {
+    break;
+  case TORNADO_SPELL:
     new_spell = new Tornado(spell_level, location, engine);
-  }
-  else if (spell_name == Heatwave::NAME) {
+    break;
+  case HEATWAVE_SPELL:
     new_spell = new Heatwave(spell_level, location, engine);
-  }
-  else if (spell_name == Coldwave::NAME) {
+    break;
+  case COLDWAVE_SPELL:
     new_spell = new Coldwave(spell_level, location, engine);
-  }
-  else if (spell_name == Drought::NAME) {
+    break;
+  case DROUGHT_SPELL:
     new_spell = new Drought(spell_level, location, engine);
-  }
-  else if (spell_name == Monsoon::NAME) {
+    break;
+  case MONSOON_SPELL:
     new_spell = new Monsoon(spell_level, location, engine);
-  }
-  else if (spell_name == Disease::NAME) {
+    break;
+  case DISEASE_SPELL:
     new_spell = new Disease(spell_level, location, engine);
-  }
-  else if (spell_name == Earthquake::NAME) {
+    break;
+  case EARTHQUAKE_SPELL:
     new_spell = new Earthquake(spell_level, location, engine);
-  }
-  else if (spell_name == Hurricane::NAME) {
+    break;
+  case HURRICANE_SPELL:
     new_spell = new Hurricane(spell_level, location, engine);
-  }
-  else if (spell_name == Plague::NAME) {
+    break;
+  case PLAGUE_SPELL:
     new_spell = new Plague(spell_level, location, engine);
-  }
-  else if (spell_name == Volcano::NAME) {
+    break;
+  case VOLCANO_SPELL:
     new_spell = new Volcano(spell_level, location, engine);
-  }
-  else if (spell_name == Asteroid::NAME) {
+    break;
+  case ASTEROID_SPELL:
     new_spell = new Asteroid(spell_level, location, engine);
-  }
-  else {
-    RequireUser(false, "Unknown spell: " << spell_name);
+    break;
+  default:
+    Require(false, "Bad spell id " << static_cast<int>(spell_id));
   }
   return std::shared_ptr<const Spell>(new_spell);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-bool SpellFactory::is_in_all_names(const std::string& spell_name)
+std::shared_ptr<const Spell>
+SpellFactory::create_spell(const std::string& spell_name,
+                           Engine&            engine,
+                           unsigned           spell_level,
+                           const Location&    location)
+///////////////////////////////////////////////////////////////////////////////
+{
+  return create_spell(id_of(spell_name), engine, spell_level, location);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const SpellPrototype& SpellFactory::prototype(SpellId spell_id)
+///////////////////////////////////////////////////////////////////////////////
+{
+  switch (spell_id) {
+  case HOT_SPELL:
+    return Hot::prototype();
+  case COLD_SPELL:
+    return Cold::prototype();
+  case WIND_SPELL:
+    return WindSpell::prototype();
+  case INFECT_SPELL:
+    return Infect::prototype();
+  case FIRE_SPELL:
+    return Fire::prototype();
+  case TSTORM_SPELL:
+    return Tstorm::prototype();
+  case SNOW_SPELL:
+    return Snow::prototype();
+  case AVALANCHE_SPELL:
+    return Avalanche::prototype();
+  case FLOOD_SPELL:
+    return Flood::prototype();
+  case DRY_SPELL:
+    return Dry::prototype();
+  case BLIZZARD_SPELL:
+    return Blizzard::prototype();
+  case TORNADO_SPELL:
+    return Tornado::prototype();
+  case HEATWAVE_SPELL:
+    return Heatwave::prototype();
+  case COLDWAVE_SPELL:
+    return Coldwave::prototype();
+  case DROUGHT_SPELL:
+    return Drought::prototype();
+  case MONSOON_SPELL:
+    return Monsoon::prototype();
+  case DISEASE_SPELL:
+    return Disease::prototype();
+  case EARTHQUAKE_SPELL:
+    return Earthquake::prototype();
+  case HURRICANE_SPELL:
+    return Hurricane::prototype();
+  case PLAGUE_SPELL:
+    return Plague::prototype();
+  case VOLCANO_SPELL:
+    return Volcano::prototype();
+  case ASTEROID_SPELL:
+    return Asteroid::prototype();
+  default:
+    Require(false, "Bad spell id " << static_cast<int>(spell_id));
+  }
+  return Hot::prototype(); // unreachable
+}
+
+///////////////////////////////////////////////////////////////////////////////
+SpellId SpellFactory::find_id(const std::string& spell_name)
 ///////////////////////////////////////////////////////////////////////////////
 {
-  for (unsigned i = 0; i < SpellFactory::num_spells(); ++i) {
-    if (ALL_SPELLS[i] == spell_name) {
-      return true;
+  // Built on first use rather than at static-init time, since ALL_SPELLS
+  // copies names defined in another translation unit
+  static const std::vector<SpellId> table = []() -> std::vector<SpellId> {
+    std::vector<SpellId> rv(HASH_TABLE_SIZE, SpellIdLAST);
+    for (SpellId id : iterate<SpellId>()) {
+      SpellId& entry = rv[hash(ALL_SPELLS[id])];
+      Require(entry == SpellIdLAST,
+              "Spell names " << ALL_SPELLS[entry] << " and " << ALL_SPELLS[id] <<
+              " collide, SpellFactory::hash needs new constants");
+      entry = id;
     }
-  }
-  return false;
+    return rv;
+  }();
+
+  const SpellId rv = table[hash(spell_name)];
+  return rv != SpellIdLAST && ALL_SPELLS[rv] == spell_name ? rv : SpellIdLAST;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+SpellId SpellFactory::id_of(const std::string& spell_name)
+///////////////////////////////////////////////////////////////////////////////
+{
+  const SpellId rv = find_id(spell_name);
+  RequireUser(rv != SpellIdLAST, "Unknown spell: " << spell_name);
+  return rv;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const std::string& SpellFactory::name_of(SpellId spell_id)
+///////////////////////////////////////////////////////////////////////////////
+{
+  Require(spell_id < SpellIdLAST, "Bad spell id " << static_cast<int>(spell_id));
+  return ALL_SPELLS[spell_id];
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 unsigned SpellFactory::num_spells()
 ///////////////////////////////////////////////////////////////////////////////
 {
-  return sizeof(ALL_SPELLS)/sizeof(std::string);
+  static_assert(sizeof(ALL_SPELLS) / sizeof(std::string) == SpellIdLAST,
+                "ALL_SPELLS and SpellId disagree");
+  return SpellIdLAST;
 }
 
 }
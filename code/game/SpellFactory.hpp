@@ -7,9 +7,37 @@
 #include <vector>
 #include <memory>
 
+// Dense ids for the kinds of spells, in the order of
+// SpellFactory::ALL_SPELLS. Names are only used at the edges (commands,
+// reports); everything else deals in ids.
+SMART_ENUM(SpellId,
+           HOT_SPELL,
+           COLD_SPELL,
+           WIND_SPELL,
+           INFECT_SPELL,
+           FIRE_SPELL,
+           TSTORM_SPELL,
+           SNOW_SPELL,
+           AVALANCHE_SPELL,
+           FLOOD_SPELL,
+           DRY_SPELL,
+           BLIZZARD_SPELL,
+           TORNADO_SPELL,
+           HEATWAVE_SPELL,
+           COLDWAVE_SPELL,
+           DROUGHT_SPELL,
+           MONSOON_SPELL,
+           DISEASE_SPELL,
+           EARTHQUAKE_SPELL,
+           HURRICANE_SPELL,
+           PLAGUE_SPELL,
+           VOLCANO_SPELL,
+           ASTEROID_SPELL);
+
 namespace baal {
 
 class Spell;
+struct SpellPrototype;
 class Engine;
 
 /**
@@ -22,16 +50,52 @@ class SpellFactory
   // client responsible for deletion
   static
   std::shared_ptr<const Spell>
+  create_spell(SpellId            spell_id,
+               Engine&            engine,
+               unsigned           spell_level = 1,
+               const Location&    location = Location());
+
+  // Parses spell_name first; throws a user error if it is not a spell
+  static
+  std::shared_ptr<const Spell>
   create_spell(const std::string& spell_name,
                Engine&            engine,
                unsigned           spell_level = 1,
                const Location&    location = Location());
 
-  static bool is_in_all_names(const std::string& spell_name);
+  // The cast-independent parts of a kind of spell (name, cost, prereqs).
+  // Prefer this to creating a throwaway spell just to inspect them.
+  static const SpellPrototype& prototype(SpellId spell_id);
+
+  /**
+   * Id of the spell named spell_name, or SpellIdLAST if there is none.
+   * One hash and one string compare.
+   */
+  static SpellId find_id(const std::string& spell_name);
+
+  // Like find_id, but throws a user error for unknown names
+  static SpellId id_of(const std::string& spell_name);
+
+  static const std::string& name_of(SpellId spell_id);
+
+  static bool is_in_all_names(const std::string& spell_name)
+  { return find_id(spell_name) != SpellIdLAST; }
 
   static unsigned num_spells();
 
   static std::string ALL_SPELLS[];
+
+ private:
+  // Perfect over ALL_SPELLS; see find_id
+  static unsigned hash(const std::string& spell_name)
+  {
+    return spell_name.size() < 2 ? 0 :
+      (static_cast<unsigned char>(spell_name[0]) * 24 +
+       static_cast<unsigned char>(spell_name[1]) * 17 +
+       spell_name.size()) % HASH_TABLE_SIZE;
+  }
+
+  static constexpr unsigned HASH_TABLE_SIZE = 32;
 };
 
 }
@@ -0,0 +1,286 @@
+#ifndef SpellSpec_hpp
+#define SpellSpec_hpp
+
+#include <array>
+#include <vector>
+#include <utility>
+
+namespace baal {
+
+// Spell specs are statically composed: each spell's factor chains are
+// nested templates over its own lambdas, so evaluating a chain is a
+// sequence of inlinable calls. A spell reaches its spec through one virtual
+// call on SpellSpecBase. Labels live apart from the functions and are only
+// read when a spell reports what it did.
+
+class WorldTile;
+class Engine;
+
+const float DOES_NOT_APPLY = -1.0;
+
+// (label, value) of each factor, collected only when reporting
+typedef std::vector<std::pair<const char*, float> > factor_report_t;
+
+/**
+ * A factor of a spell: a function of (tile, spell level, engine) and the
+ * label it is reported under. Land factors depend on the ground rather than
+ * the weather; products can be asked to leave them out.
+ */
+template <class Func, bool IS_LAND>
+struct Factor
+{
+  static constexpr bool LAND = IS_LAND;
+
+  const char* m_label;
+  Func        m_func;
+};
+
+template <class Func>
+Factor<Func, false> factor(const char* label, Func func)
+{ return Factor<Func, false>{label, func}; }
+
+template <class Func>
+Factor<Func, true> land_factor(const char* label, Func func)
+{ return Factor<Func, true>{label, func}; }
+
+namespace details { // Clients, stay away!
+
+// The functions of a chain, without their labels. Folds run left to right,
+// in the order the factors were given.
+template <class... Factors>
+class FactorFuncs;
+
+template <>
+class FactorFuncs<>
+{
+ public:
+  FactorFuncs() {}
+
+  float multiply(float acc, const WorldTile&, unsigned, const Engine&, bool) const
+  { return acc; }
+
+  float divide(float acc, const WorldTile&, unsigned, const Engine&) const
+  { return acc; }
+
+  void evaluate(const WorldTile&, unsigned, const Engine&, float*) const {}
+};
+
+template <class Func, bool LAND, class... Rest>
+class FactorFuncs<Factor<Func, LAND>, Rest...>
+{
+ public:
+  FactorFuncs(const Factor<Func, LAND>& first, const Rest&... rest)
+    : m_func(first.m_func), m_rest(rest...)
+  {}
+
+  float multiply(float acc, const WorldTile& tile, unsigned level, const Engine& engine, bool with_land) const
+  {
+    if (with_land || !LAND) {
+      acc *= m_func(tile, level, engine);
+    }
+    return m_rest.multiply(acc, tile, level, engine, with_land);
+  }
+
+  float divide(float acc, const WorldTile& tile, unsigned level, const Engine& engine) const
+  { return m_rest.divide(acc / m_func(tile, level, engine), tile, level, engine); }
+
+  // Write each factor's value, in order, starting at values
+  void evaluate(const WorldTile& tile, unsigned level, const Engine& engine, float* values) const
+  {
+    *values = m_func(tile, level, engine);
+    m_rest.evaluate(tile, level, engine, values + 1);
+  }
+
+ private:
+  Func                 m_func;
+  FactorFuncs<Rest...> m_rest;
+};
+
+}
+
+/**
+ * An ordered chain of factors, applied either as multipliers
+ * (destructiveness) or as divisors (mitigation of a base amount).
+ */
+template <class... Factors>
+class FactorChain
+{
+ public:
+  static constexpr unsigned SIZE = sizeof...(Factors);
+
+  explicit FactorChain(const Factors&... factors)
+    : m_funcs(factors...),
+      m_labels{{factors.m_label...}},
+      m_land{{Factors::LAND...}}
+  {}
+
+  float product(const WorldTile& tile, unsigned level, const Engine& engine, bool with_land) const
+  { return m_funcs.multiply(1.0, tile, level, engine, with_land); }
+
+  float product(const WorldTile& tile, unsigned level, const Engine& engine, bool with_land,
+                factor_report_t& report) const
+  {
+    std::array<float, SIZE> values;
+    m_funcs.evaluate(tile, level, engine, values.data());
+
+    float rv = 1.0;
+    for (unsigned i = 0; i < SIZE; ++i) {
+      if (with_land || !m_land[i]) {
+        rv *= values[i];
+        report.emplace_back(m_labels[i], values[i]);
+      }
+    }
+    return rv;
+  }
+
+  float mitigate(float base, const WorldTile& tile, unsigned level, const Engine& engine) const
+  { return m_funcs.divide(base, tile, level, engine); }
+
+  float mitigate(float base, const WorldTile& tile, unsigned level, const Engine& engine,
+                 factor_report_t& report) const
+  {
+    std::array<float, SIZE> values;
+    m_funcs.evaluate(tile, level, engine, values.data());
+
+    for (unsigned i = 0; i < SIZE; ++i) {
+      base /= values[i];
+      report.emplace_back(m_labels[i], values[i]);
+    }
+    return base;
+  }
+
+ private:
+  details::FactorFuncs<Factors...> m_funcs;
+  std::array<const char*, SIZE>    m_labels; // only read when reporting
+  std::array<bool, SIZE>           m_land;
+};
+
+template <class... Factors>
+FactorChain<Factors...> make_factors(const Factors&... factors)
+{ return FactorChain<Factors...>(factors...); }
+
+/**
+ * A base amount, from the tile and the spell's destructiveness, that a
+ * chain of factors then mitigates
+ */
+template <class Base, class Chain>
+struct Mitigated
+{
+  Base  m_base;
+  Chain m_mitigation;
+};
+
+template <class Base, class Chain>
+Mitigated<Base, Chain> make_mitigated(Base base, const Chain& mitigation)
+{ return Mitigated<Base, Chain>{base, mitigation}; }
+
+/**
+ * How a spell works, as seen by Spell: destructiveness, then for each
+ * effect a base amount and its mitigation.
+ */
+class SpellSpecBase
+{
+ public:
+  enum Effect {
+    KILL,
+    INFRA_DMG,
+    DEFENSE_DMG
+  };
+
+  virtual ~SpellSpecBase() = default;
+
+  // Product of the destructiveness factors; land factors only if with_land.
+  // If report is not null, each factor used is appended to it.
+  virtual float destructiveness(const WorldTile& tile, unsigned level, const Engine& engine,
+                                bool with_land, factor_report_t* report) const = 0;
+
+  // Base amount of effect before mitigation, or DOES_NOT_APPLY
+  virtual float base(Effect effect, const WorldTile& tile, float destructiveness) const = 0;
+
+  virtual float mitigate(Effect effect, float base, const WorldTile& tile, unsigned level,
+                         const Engine& engine, factor_report_t* report) const = 0;
+
+  // Percent damage to the tile, or DOES_NOT_APPLY
+  virtual float tile_dmg(const WorldTile& tile, float destructiveness) const = 0;
+};
+
+template <class Destructiveness, class Kill, class InfraDmg, class DefenseDmg, class TileDmg>
+class SpellSpec : public SpellSpecBase
+{
+ public:
+  SpellSpec(const Destructiveness& destructiveness,
+            const Kill&            kill,
+            const InfraDmg&        infra_dmg,
+            const DefenseDmg&      defense_dmg,
+            const TileDmg&         tile_dmg)
+    : m_destructiveness_spec(destructiveness),
+      m_kill_spec(kill),
+      m_infra_dmg_spec(infra_dmg),
+      m_defense_dmg_spec(defense_dmg),
+      m_tile_dmg_spec(tile_dmg)
+  {}
+
+  virtual float destructiveness(const WorldTile& tile, unsigned level, const Engine& engine,
+                                bool with_land, factor_report_t* report) const
+  {
+    return report == nullptr ?
+      m_destructiveness_spec.product(tile, level, engine, with_land) :
+      m_destructiveness_spec.product(tile, level, engine, with_land, *report);
+  }
+
+  virtual float base(Effect effect, const WorldTile& tile, float destructiveness) const
+  {
+    switch (effect) {
+    case KILL:        return m_kill_spec.m_base(tile, destructiveness);
+    case INFRA_DMG:   return m_infra_dmg_spec.m_base(tile, destructiveness);
+    case DEFENSE_DMG: return m_defense_dmg_spec.m_base(tile, destructiveness);
+    }
+    return DOES_NOT_APPLY;
+  }
+
+  virtual float mitigate(Effect effect, float base, const WorldTile& tile, unsigned level,
+                         const Engine& engine, factor_report_t* report) const
+  {
+    switch (effect) {
+    case KILL:        return mitigate(m_kill_spec.m_mitigation, base, tile, level, engine, report);
+    case INFRA_DMG:   return mitigate(m_infra_dmg_spec.m_mitigation, base, tile, level, engine, report);
+    case DEFENSE_DMG: return mitigate(m_defense_dmg_spec.m_mitigation, base, tile, level, engine, report);
+    }
+    return base;
+  }
+
+  virtual float tile_dmg(const WorldTile& tile, float destructiveness) const
+  { return m_tile_dmg_spec(tile, destructiveness); }
+
+ private:
+  template <class Chain>
+  static float mitigate(const Chain& chain, float base, const WorldTile& tile, unsigned level,
+                        const Engine& engine, factor_report_t* report)
+  {
+    return report == nullptr ?
+      chain.mitigate(base, tile, level, engine) :
+      chain.mitigate(base, tile, level, engine, *report);
+  }
+
+  Destructiveness m_destructiveness_spec;
+  Kill            m_kill_spec;
+  InfraDmg        m_infra_dmg_spec;
+  DefenseDmg      m_defense_dmg_spec;
+  TileDmg         m_tile_dmg_spec;
+};
+
+template <class Destructiveness, class Kill, class InfraDmg, class DefenseDmg, class TileDmg>
+SpellSpec<Destructiveness, Kill, InfraDmg, DefenseDmg, TileDmg>
+make_spell_spec(const Destructiveness& destructiveness,
+                const Kill&            kill,
+                const InfraDmg&        infra_dmg,
+                const DefenseDmg&      defense_dmg,
+                const TileDmg&         tile_dmg)
+{
+  return SpellSpec<Destructiveness, Kill, InfraDmg, DefenseDmg, TileDmg>(
+    destructiveness, kill, infra_dmg, defense_dmg, tile_dmg);
+}
+
+}
+
+#endif
@@ -3,34 +3,22 @@
 #include "BaalExceptions.hpp"
 #include "Player.hpp"
 #include "SpellFactory.hpp"
+#include "Snapshot.hpp"
 
 namespace baal {
 
 ///////////////////////////////////////////////////////////////////////////////
-void TalentTree::add(const std::string& spell_name)
+void TalentTree::add(SpellId spell_id)
 ///////////////////////////////////////////////////////////////////////////////
 {
-  map_type::iterator find_iter = m_spell_level_map.find(spell_name);
-  unsigned spell_level;
-
   // Compute implied spell-level
-  if (find_iter != m_spell_level_map.end()) {
-    spell_level = find_iter->second + 1;
-  }
-  else {
-    spell_level = 1;
-  }
+  const unsigned spell_level = m_spell_levels[spell_id] + 1;
 
   // Check if it is OK for them to learn this spell
-  check_prereqs(spell_name, spell_level, m_player.level());
+  check_prereqs(spell_id, spell_level, m_player.level());
 
   // Add spell
-  if (find_iter == m_spell_level_map.end()) {
-    m_spell_level_map[spell_name] = 1;
-  }
-  else {
-    m_spell_level_map[spell_name] += 1;
-  }
+  m_spell_levels[spell_id] = spell_level;
 
   ++m_num_learned;
 
@@ -41,20 +29,15 @@ void TalentTree::add(const std::string& spell_name)
 bool TalentTree::has(const Spell& spell) const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  return has(spell.name(), spell.level());
+  return has(spell.id(), spell.level());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 bool TalentTree::has(const std::string& spell_name, unsigned spell_level) const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  map_type::const_iterator find_iter = m_spell_level_map.find(spell_name);
-  if (find_iter == m_spell_level_map.end()) {
-    return false;
-  }
-  else {
-    return find_iter->second >= spell_level;
-  }
+  const SpellId spell_id = SpellFactory::find_id(spell_name);
+  return spell_id != SpellIdLAST && has(spell_id, spell_level);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -64,13 +47,11 @@ TalentTree::query_return_type TalentTree::query_all_castable_spells() const
   query_return_type rv;
   rv.reserve(m_num_learned);
 
-  for (map_type::const_iterator
-       itr = m_spell_level_map.begin();
-       itr != m_spell_level_map.end();
-       ++itr) {
-    std::string spell_name = itr->first;
-    unsigned max_level = itr->second;
-    rv.push_back(std::make_pair(spell_name, max_level));
+  for (SpellId spell_id : iterate<SpellId>()) {
+    const unsigned max_level = m_spell_levels[spell_id];
+    if (max_level > 0) {
+      rv.push_back(std::make_pair(SpellFactory::name_of(spell_id), max_level));
+    }
   }
 
   return rv;
@@ -80,29 +61,19 @@ TalentTree::query_return_type TalentTree::query_all_castable_spells() const
 TalentTree::query_return_type TalentTree::query_all_learnable_spells() const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  const unsigned num_spells = SpellFactory::num_spells();
-
   query_return_type rv;
-  rv.reserve(num_spells);
-
-  for (unsigned i = 0; i < num_spells; ++i) {
-    std::string spell_name(SpellFactory::ALL_SPELLS[i]);
-    map_type::const_iterator
-      fitr= m_spell_level_map.find(spell_name);
-    if (fitr != m_spell_level_map.end()) {
-      if (fitr->second != MAX_SPELL_LEVEL) {
-        rv.push_back(std::make_pair(spell_name, fitr->second + 1));
+  rv.reserve(SpellFactory::num_spells());
+
+  for (SpellId spell_id : iterate<SpellId>()) {
+    const std::string& spell_name = SpellFactory::name_of(spell_id);
+    const unsigned spell_level = m_spell_levels[spell_id];
+    if (spell_level > 0) {
+      if (spell_level != MAX_SPELL_LEVEL) {
+        rv.push_back(std::make_pair(spell_name, spell_level + 1));
       }
     }
     else {
-      bool prereqs_ok = true;
-      try {
-        check_prereqs(spell_name, 1 /*spell-level*/, m_player.level() + 1);
-      }
-      catch (...) {
-        prereqs_ok = false;
-      }
-      if (prereqs_ok) {
+      if (check_learn(spell_id, 1 /*spell-level*/, m_player.level() + 1) == CAN_LEARN) {
         rv.push_back(std::make_pair(spell_name, 1 /*level*/));
       }
     }
@@ -115,11 +86,8 @@ void TalentTree::validate_invariants() const
 ///////////////////////////////////////////////////////////////////////////////
 {
   unsigned computed_num_learned = 0;
-  for (map_type::const_iterator
-       itr = m_spell_level_map.begin();
-       itr != m_spell_level_map.end();
-       ++itr) {
-    computed_num_learned += itr->second;
+  for (unsigned spell_level : m_spell_levels) {
+    computed_num_learned += spell_level;
   }
 
   Require(m_num_learned == computed_num_learned,
@@ -127,27 +95,58 @@ void TalentTree::validate_invariants() const
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void TalentTree::check_prereqs(const std::string& spell_name,
+TalentTree::LearnCheck TalentTree::check_learn(SpellId spell_id,
+                                               unsigned spell_level,
+                                               unsigned player_level,
+                                               SpellId* missing_prereq) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  if (player_level <= m_num_learned) {
+    return NO_FREE_SLOT;
+  }
+
+  if (spell_level > MAX_SPELL_LEVEL) {
+    return AT_MAX_LEVEL;
+  }
+
+  const SpellPrereq& prereq = SpellFactory::prototype(spell_id).m_prereq;
+
+  if (player_level < prereq.min_player_level()) {
+    return PLAYER_LEVEL_TOO_LOW;
+  }
+
+  for (SpellId prereq_id : prereq) {
+    if (!has(prereq_id)) {
+      if (missing_prereq != nullptr) {
+        *missing_prereq = prereq_id;
+      }
+      return MISSING_PREREQ;
+    }
+  }
+
+  return CAN_LEARN;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TalentTree::check_prereqs(SpellId spell_id,
                                unsigned spell_level,
                                unsigned player_level) const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  auto spell = SpellFactory::create_spell(spell_name,
-                                      const_cast<Engine&>(m_player.engine()));
-  const SpellPrereq& prereq = spell->prereq();
+  SpellId missing_prereq = SpellIdLAST;
+  const LearnCheck check = check_learn(spell_id, spell_level, player_level, &missing_prereq);
 
-  RequireUser(player_level > m_num_learned,
+  RequireUser(check != NO_FREE_SLOT,
               "You cannot learn any more spells until you level-up");
 
-  RequireUser(spell_level <= MAX_SPELL_LEVEL,
+  RequireUser(check != AT_MAX_LEVEL,
               "You've hit the maximum level for that spell");
 
-  RequireUser(player_level >= prereq.min_player_level(),
+  RequireUser(check != PLAYER_LEVEL_TOO_LOW,
               "You are not high-enough level to learn that spell");
 
-  for (const std::string& spell_name : prereq) {
-    RequireUser(has(spell_name), "Missing required prereq " << spell_name);
-  }
+  RequireUser(check != MISSING_PREREQ,
+              "Missing required prereq " << SpellFactory::name_of(missing_prereq));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -177,16 +176,33 @@ xmlNodePtr TalentTree::to_xml()
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-unsigned TalentTree::spell_skill(const std::string& spell_name) const
+void TalentTree::save(SnapshotWriter& out) const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  map_type::const_iterator find_iter = m_spell_level_map.find(spell_name);
-  if (find_iter != m_spell_level_map.end()) {
-    return find_iter->second;
+  for (unsigned spell_level : m_spell_levels) {
+    out.write(spell_level);
   }
-  else {
-    return 0;
+  out.write(m_num_learned);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TalentTree::load(SnapshotReader& in)
+///////////////////////////////////////////////////////////////////////////////
+{
+  for (unsigned& spell_level : m_spell_levels) {
+    spell_level = in.read<unsigned>();
   }
+  m_num_learned = in.read<unsigned>();
+
+  validate_invariants();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned TalentTree::spell_skill(const std::string& spell_name) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  const SpellId spell_id = SpellFactory::find_id(spell_name);
+  return spell_id != SpellIdLAST ? spell_skill(spell_id) : 0;
 }
 
 }
@@ -1,7 +1,9 @@
 #ifndef TalentTree_hpp
 #define TalentTree_hpp
 
-#include <map>
+#include "SpellFactory.hpp"
+
+#include <array>
 #include <string>
 #include <vector>
 #include <utility>
@@ -11,30 +13,44 @@ namespace baal {
 
 class Spell;
 class Player;
+class SnapshotWriter;
+class SnapshotReader;
 
 /**
  * Keeps track of a Player's talent tree and enforces spell prereqs.
+ *
+ * Levels are kept per SpellId; the name-based methods are for the command
+ * layer and parse the name first.
  */
 class TalentTree
 {
  public:
   typedef std::vector<std::pair<std::string, unsigned> > query_return_type;
-  typedef std::map<std::string, unsigned> map_type;
+  typedef std::array<unsigned, SpellIdLAST> levels_type;
 
   TalentTree(const Player& player) :
+    m_spell_levels(),
     m_num_learned(0),
     m_player(player)
-  {}
+  {
+    m_spell_levels.fill(0);
+  }
 
   ~TalentTree() = default;
 
   TalentTree(const TalentTree&) = delete;
   TalentTree& operator=(const TalentTree&) = delete;
 
-  void add(const std::string& spell_name);
+  void add(const std::string& spell_name) { add(SpellFactory::id_of(spell_name)); }
+
+  void add(SpellId spell_id);
 
   bool has(const Spell& spell) const;
 
+  bool has(SpellId spell_id, unsigned spell_level = 1) const
+  { return m_spell_levels[spell_id] >= spell_level; }
+
+  // False for names that are not spells
   bool has(const std::string& spell_name, unsigned spell_level = 1) const;
 
   unsigned num_learned() const { return m_num_learned; }
@@ -43,19 +59,43 @@ class TalentTree
 
   query_return_type query_all_learnable_spells() const;
 
+  unsigned spell_skill(SpellId spell_id) const { return m_spell_levels[spell_id]; }
+
+  // Zero for names that are not spells
   unsigned spell_skill(const std::string& spell_name) const;
 
   xmlNodePtr to_xml();
 
+  void save(SnapshotWriter& out) const;
+
+  void load(SnapshotReader& in);
+
   static const unsigned MAX_SPELL_LEVEL = 5;
 
  private:
-  void check_prereqs(const std::string& spell_name,
+  // Why a spell cannot be learned, or CAN_LEARN
+  enum LearnCheck {
+    CAN_LEARN,
+    NO_FREE_SLOT,
+    AT_MAX_LEVEL,
+    PLAYER_LEVEL_TOO_LOW,
+    MISSING_PREREQ // see missing_prereq
+  };
+
+  // Does not throw, so that queries over every spell stay cheap. If
+  // missing_prereq is not null, it receives the missing prereq.
+  LearnCheck check_learn(SpellId spell_id,
+                         unsigned spell_level,
+                         unsigned player_level,
+                         SpellId* missing_prereq = nullptr) const;
+
+  // Throwing form of check_learn
+  void check_prereqs(SpellId spell_id,
                      unsigned spell_level,
                      unsigned player_level) const;
   void validate_invariants() const;
 
-  map_type      m_spell_level_map;
+  levels_type   m_spell_levels; // zero if not learned
   unsigned      m_num_learned;
   const Player& m_player;
 };
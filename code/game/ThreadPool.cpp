@@ -0,0 +1,153 @@
+#include "ThreadPool.hpp"
+#include "BaalExceptions.hpp"
+
+#include <algorithm>
+
+namespace baal {
+
+///////////////////////////////////////////////////////////////////////////////
+ThreadPool::ThreadPool(unsigned num_threads)
+///////////////////////////////////////////////////////////////////////////////
+  : m_workers(),
+    m_body(nullptr),
+    m_begin(0),
+    m_end(0),
+    m_num_chunks(0),
+    m_pending(0),
+    m_generation(0),
+    m_shutdown(false),
+    m_error()
+{
+  Require(num_threads > 0, "Need at least one thread");
+
+  for (unsigned i = 0; i < num_threads - 1; ++i) {
+    m_workers.emplace_back(&ThreadPool::worker_loop, this, i);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ThreadPool::~ThreadPool()
+///////////////////////////////////////////////////////////////////////////////
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_shutdown = true;
+  }
+  m_work_cv.notify_all();
+
+  for (std::thread& worker : m_workers) {
+    worker.join();
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned ThreadPool::default_num_threads()
+///////////////////////////////////////////////////////////////////////////////
+{
+  // hardware_concurrency is allowed to return 0 if it does not know
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ThreadPool::run_chunk(unsigned chunk)
+///////////////////////////////////////////////////////////////////////////////
+{
+  const unsigned total = m_end - m_begin;
+  const unsigned chunk_begin = m_begin + (total * chunk) / m_num_chunks;
+  const unsigned chunk_end   = m_begin + (total * (chunk + 1)) / m_num_chunks;
+
+  (*m_body)(chunk_begin, chunk_end);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ThreadPool::parallel_for(unsigned begin,
+                              unsigned end,
+                              const std::function<void(unsigned, unsigned)>& body)
+///////////////////////////////////////////////////////////////////////////////
+{
+  if (begin >= end) {
+    return;
+  }
+
+  const unsigned num_chunks = std::min(num_threads(), end - begin);
+  if (num_chunks == 1) {
+    body(begin, end);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Require(m_body == nullptr, "parallel_for is not reentrant");
+    m_body       = &body;
+    m_begin      = begin;
+    m_end        = end;
+    m_num_chunks = num_chunks;
+    m_pending    = num_chunks - 1;
+    m_error      = nullptr;
+    ++m_generation;
+  }
+  m_work_cv.notify_all();
+
+  // The calling thread always takes the first chunk
+  std::exception_ptr error;
+  try {
+    run_chunk(0);
+  }
+  catch (...) {
+    error = std::current_exception();
+  }
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_done_cv.wait(lock, [this] { return m_pending == 0; });
+  m_body = nullptr;
+  if (!error) {
+    error = m_error;
+  }
+  lock.unlock();
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ThreadPool::worker_loop(unsigned worker_id)
+///////////////////////////////////////////////////////////////////////////////
+{
+  const unsigned chunk = worker_id + 1; // chunk 0 belongs to the caller
+  unsigned seen_generation = 0;
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    m_work_cv.wait(lock, [&] {
+        return m_shutdown || m_generation != seen_generation;
+      });
+    if (m_shutdown) {
+      return;
+    }
+    seen_generation = m_generation;
+
+    if (chunk >= m_num_chunks) {
+      continue; // not enough work to go around this time
+    }
+
+    lock.unlock();
+    std::exception_ptr error;
+    try {
+      run_chunk(chunk);
+    }
+    catch (...) {
+      error = std::current_exception();
+    }
+    lock.lock();
+
+    if (error && !m_error) {
+      m_error = error;
+    }
+    if (--m_pending == 0) {
+      m_done_cv.notify_one();
+    }
+  }
+}
+
+}
@@ -0,0 +1,68 @@
+#ifndef ThreadPool_hpp
+#define ThreadPool_hpp
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+namespace baal {
+
+/**
+ * A fixed set of worker threads for data-parallel loops. The calling thread
+ * takes part in every loop, so a pool of N threads runs N - 1 workers.
+ *
+ * Work is split into contiguous chunks in a fixed way, so callers that only
+ * write to state owned by their chunk get the same result for any number
+ * of threads.
+ */
+class ThreadPool
+{
+ public:
+  explicit ThreadPool(unsigned num_threads);
+
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  unsigned num_threads() const { return m_workers.size() + 1; }
+
+  /**
+   * Split [begin, end) into at most num_threads() contiguous chunks and call
+   * body(chunk_begin, chunk_end) once per chunk, in parallel. Blocks until
+   * every chunk is done. An exception thrown by body is rethrown here.
+   */
+  void parallel_for(unsigned begin,
+                    unsigned end,
+                    const std::function<void(unsigned, unsigned)>& body);
+
+  // Number of threads to use when the caller has no preference
+  static unsigned default_num_threads();
+
+ private:
+  void worker_loop(unsigned worker_id);
+
+  void run_chunk(unsigned chunk);
+
+  std::vector<std::thread> m_workers;
+  std::mutex               m_mutex;
+  std::condition_variable  m_work_cv;
+  std::condition_variable  m_done_cv;
+
+  // State of the current loop, guarded by m_mutex
+  const std::function<void(unsigned, unsigned)>* m_body;
+  unsigned           m_begin;
+  unsigned           m_end;
+  unsigned           m_num_chunks;
+  unsigned           m_pending;    // worker chunks not yet finished
+  unsigned           m_generation; // bumped for every loop
+  bool               m_shutdown;
+  std::exception_ptr m_error;
+};
+
+}
+
+#endif
@@ -0,0 +1,65 @@
+#include "TileColumns.hpp"
+#include "BaalExceptions.hpp"
+
+namespace baal {
+
+///////////////////////////////////////////////////////////////////////////////
+TileColumns::TileColumns(unsigned size)
+///////////////////////////////////////////////////////////////////////////////
+  : m_temperature(size, 0),
+    m_precip(size, 0.0),
+    m_pressure(size, 0),
+    m_soil_moisture(size, 0.0),
+    m_snowpack(size, 0),
+    m_infra_level(size, 0),
+    m_hp(size, 0.0),
+    m_yield_version(size, 0),
+    m_casted(size, 0)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void TileColumns::copy_slot(unsigned dst_idx, const TileColumns& src, unsigned src_idx)
+///////////////////////////////////////////////////////////////////////////////
+{
+  Require(dst_idx < size(), "Bad slot " << dst_idx);
+  Require(src_idx < src.size(), "Bad slot " << src_idx);
+
+  m_temperature[dst_idx]   = src.m_temperature[src_idx];
+  m_precip[dst_idx]        = src.m_precip[src_idx];
+  m_pressure[dst_idx]      = src.m_pressure[src_idx];
+  m_soil_moisture[dst_idx] = src.m_soil_moisture[src_idx];
+  m_snowpack[dst_idx]      = src.m_snowpack[src_idx];
+  m_infra_level[dst_idx]   = src.m_infra_level[src_idx];
+  m_hp[dst_idx]            = src.m_hp[src_idx];
+  m_yield_version[dst_idx] = src.m_yield_version[src_idx];
+  m_casted[dst_idx]        = src.m_casted[src_idx];
+}
+
+/*****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////////
+TileSlot::TileSlot(const SlotPlacement& placement)
+///////////////////////////////////////////////////////////////////////////////
+  : m_own_columns(placement.m_columns == nullptr ? new TileColumns(1) : nullptr),
+    m_columns(placement.m_columns == nullptr ? m_own_columns.get() : placement.m_columns),
+    m_index(placement.m_index)
+{
+  Require(m_index < m_columns->size(), "Bad slot " << m_index);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TileSlot::bind(TileColumns& columns, unsigned index)
+///////////////////////////////////////////////////////////////////////////////
+{
+  if (m_columns == &columns && m_index == index) {
+    return;
+  }
+  Require(m_own_columns != nullptr, "Slot was already bound");
+
+  columns.copy_slot(index, *m_columns, m_index);
+  m_columns = &columns;
+  m_index   = index;
+  m_own_columns.reset();
+}
+
+}
@@ -0,0 +1,108 @@
+#ifndef TileColumns_hpp
+#define TileColumns_hpp
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+namespace baal {
+
+/**
+ * Structure-of-arrays storage for the per-tile fields that are touched on
+ * every turn and every draw. The World owns one of these, sized to the map
+ * and laid out row-major, so whole-map passes walk contiguous memory.
+ */
+struct TileColumns
+{
+  explicit TileColumns(unsigned size);
+
+  TileColumns(const TileColumns&) = delete;
+  TileColumns& operator=(const TileColumns&) = delete;
+
+  unsigned size() const { return m_hp.size(); }
+
+  // Copy every field of src's slot src_idx into our slot dst_idx
+  void copy_slot(unsigned dst_idx, const TileColumns& src, unsigned src_idx);
+
+  // Atmosphere fields
+  std::vector<int>      m_temperature;   // in farenheit
+  std::vector<float>    m_precip;        // in inches, most recent season
+  std::vector<unsigned> m_pressure;      // in millibars
+
+  // Land fields
+  std::vector<float>    m_soil_moisture;
+  std::vector<unsigned> m_snowpack;      // in inches
+  std::vector<unsigned> m_infra_level;
+  std::vector<float>    m_hp;            // 0..1
+
+  // Bumped whenever something that feeds into the tile's yield changes, so
+  // that caches of yield-derived values can tell when they are stale
+  std::vector<unsigned> m_yield_version;
+
+  // One bit per SpellId cast on the tile this turn. Kept as a column so the
+  // World can forget every cast on the map with a single fill.
+  std::vector<std::uint32_t> m_casted;
+};
+
+/**
+ * Where a new tile's slot lives. By default a tile gets storage of its
+ * own until it is placed in a world; a factory that builds tiles for a
+ * world it already has can put them straight into their final slot.
+ */
+struct SlotPlacement
+{
+  SlotPlacement() : m_columns(nullptr), m_index(0) {}
+
+  SlotPlacement(TileColumns& columns, unsigned index) : m_columns(&columns), m_index(index) {}
+
+  TileColumns* m_columns; // null for storage of its own
+  unsigned     m_index;
+};
+
+/**
+ * A handle to one tile's slot in a TileColumns. Tiles and atmospheres read
+ * and write their hot fields through one of these.
+ *
+ * A freshly created slot owns a private one-slot TileColumns so that tiles
+ * can be built before they are placed in a world; bind() moves the slot's
+ * values into the world's columns and drops the private storage. Slots
+ * created with a placement into a world's columns never have any.
+ */
+class TileSlot
+{
+ public:
+  explicit TileSlot(const SlotPlacement& placement = SlotPlacement());
+
+  TileSlot(const TileSlot&) = delete;
+  TileSlot& operator=(const TileSlot&) = delete;
+
+  // Does nothing if the slot is already there
+  void bind(TileColumns& columns, unsigned index);
+
+  TileColumns& columns() const { return *m_columns; }
+
+  unsigned index() const { return m_index; }
+
+  int&      temperature()   const { return m_columns->m_temperature[m_index]; }
+  float&    precip()        const { return m_columns->m_precip[m_index]; }
+  unsigned& pressure()      const { return m_columns->m_pressure[m_index]; }
+  float&    soil_moisture() const { return m_columns->m_soil_moisture[m_index]; }
+  unsigned& snowpack()      const { return m_columns->m_snowpack[m_index]; }
+  unsigned& infra_level()   const { return m_columns->m_infra_level[m_index]; }
+  float&    hp()            const { return m_columns->m_hp[m_index]; }
+
+  unsigned yield_version() const { return m_columns->m_yield_version[m_index]; }
+
+  void touch_yield() const { ++m_columns->m_yield_version[m_index]; }
+
+  std::uint32_t& casted() const { return m_columns->m_casted[m_index]; }
+
+ private:
+  std::unique_ptr<TileColumns> m_own_columns;
+  TileColumns*                 m_columns;
+  unsigned                     m_index;
+};
+
+}
+
+#endif
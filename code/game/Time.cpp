@@ -1,6 +1,7 @@
 #include "Time.hpp"
 #include "BaalExceptions.hpp"
 #include "BaalCommon.hpp"
+#include "Snapshot.hpp"
 
 namespace baal {
 
@@ -41,4 +42,20 @@ xmlNodePtr Time::to_xml()
   return Time_node;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void Time::save(SnapshotWriter& out) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  out.write(m_curr_year);
+  out.write(m_curr_season);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Time::load(SnapshotReader& in)
+///////////////////////////////////////////////////////////////////////////////
+{
+  m_curr_year   = in.read<unsigned>();
+  m_curr_season = in.read_enum<Season>();
+}
+
 }
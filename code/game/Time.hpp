@@ -12,6 +12,9 @@ SMART_ENUM(Season, WINTER, SPRING, SUMMER, FALL);
 
 namespace baal {
 
+class SnapshotWriter;
+class SnapshotReader;
+
 /**
  * Encapsulates how time elapses in the system.
  */
@@ -26,8 +29,16 @@ class Time
 
   unsigned year() const { return m_curr_year; }
 
+  // Number of seasons elapsed since the start of the game
+  unsigned turn() const
+  { return (m_curr_year - STARTING_YEAR) * baal::size<Season>() + m_curr_season; }
+
   xmlNodePtr to_xml();
 
+  void save(SnapshotWriter& out) const;
+
+  void load(SnapshotReader& in);
+
   // Constants
   static const unsigned STARTING_YEAR = 0;
 
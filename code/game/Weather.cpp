@@ -2,16 +2,56 @@
 #include "BaalExceptions.hpp"
 #include "WorldTile.hpp"
 #include "World.hpp"
+#include "Snapshot.hpp"
+#include "ThreadPool.hpp"
 
 #include <cstdlib>
+#include <algorithm>
+#include <numeric>
 #include <iomanip>
 
 namespace baal {
 
+constexpr unsigned Climate::INVALID_ID;
 const unsigned Anomaly::MAX_INTENSITY;
+constexpr float Anomaly::ANOMALY_ROLL_BAND;
+constexpr float Anomaly::ANOMALY_PROBABILITY;
 
 ///////////////////////////////////////////////////////////////////////////////
-xmlNodePtr Climate::to_xml()
+Climate::Climate(std::vector<int> const& temperature,
+                 std::vector<float> const& precip,
+                 std::vector<Wind> const& wind)
+///////////////////////////////////////////////////////////////////////////////
+  : m_id(INVALID_ID)
+{
+  const size_t num_seasons = baal::size<Season>();
+
+  Require(temperature.size() == num_seasons, "Wrong number of temperatures " << temperature.size());
+  Require(precip.size()      == num_seasons, "Wrong number of precip "       << precip.size());
+  Require(wind.size()        == num_seasons, "Wrong number of wind "         << wind.size());
+
+  std::copy(temperature.begin(), temperature.end(), m_temperature.begin());
+  std::copy(precip.begin(),      precip.end(),      m_precip.begin());
+  std::copy(wind.begin(),        wind.end(),        m_wind.begin());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t Climate::hash() const
+///////////////////////////////////////////////////////////////////////////////
+{
+  std::size_t rv = 0;
+  auto combine = [&rv](std::size_t value) { rv = rv * 31 + value; };
+  for (Season s : iterate<Season>()) {
+    combine(std::hash<int>()(m_temperature[s]));
+    combine(std::hash<float>()(m_precip[s] + 0.0f)); // -0 == +0
+    combine(m_wind[s].m_speed);
+    combine(m_wind[s].m_direction);
+  }
+  return rv;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+xmlNodePtr Climate::to_xml() const
 ///////////////////////////////////////////////////////////////////////////////
 {
   xmlNodePtr Climate_node = xmlNewNode(nullptr, BAD_CAST "Climate");
@@ -30,16 +70,120 @@ xmlNodePtr Climate::to_xml()
   return Climate_node;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void Climate::save(SnapshotWriter& out) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  for (Season s : iterate<Season>()) {
+    out.write(m_temperature[s]);
+    out.write(m_precip[s]);
+    out.write(m_wind[s].m_speed);
+    out.write(m_wind[s].m_direction);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const Climate& Climate::load(SnapshotReader& in)
+///////////////////////////////////////////////////////////////////////////////
+{
+  Temperatures temperature;
+  Precips      precip;
+  Winds        wind;
+  for (Season s : iterate<Season>()) {
+    temperature[s] = in.read<int>();
+    precip[s]      = in.read<float>();
+    const unsigned speed = in.read<unsigned>();
+    wind[s] = Wind(speed, in.read_enum<Direction>());
+  }
+
+  return ClimateTable::intern(temperature, precip, wind);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const Climate& ClimateTable::intern(Climate const& climate)
+///////////////////////////////////////////////////////////////////////////////
+{
+  ClimateTable& table = instance();
+  std::lock_guard<std::mutex> lock(table.m_mutex);
+
+  auto itr = table.m_ids.find(climate);
+  if (itr != table.m_ids.end()) {
+    return table.m_records[itr->second];
+  }
+
+  const unsigned id = table.m_records.size();
+  Require(id != Climate::INVALID_ID, "Too many climates");
+
+  // deque::push_back never moves existing records
+  table.m_records.push_back(climate);
+  table.m_records.back().m_id = id;
+  table.m_ids.emplace(climate, id);
+  return table.m_records.back();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const Climate& ClimateTable::get(unsigned id)
+///////////////////////////////////////////////////////////////////////////////
+{
+  ClimateTable& table = instance();
+  std::lock_guard<std::mutex> lock(table.m_mutex);
+
+  Require(id < table.m_records.size(), "Bad climate id " << id);
+  return table.m_records[id];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t ClimateTable::size()
+///////////////////////////////////////////////////////////////////////////////
+{
+  ClimateTable& table = instance();
+  std::lock_guard<std::mutex> lock(table.m_mutex);
+
+  return table.m_records.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ClimateTable& ClimateTable::instance()
+///////////////////////////////////////////////////////////////////////////////
+{
+  // Never destroyed, so tiles of engines torn down during static
+  // destruction can still refer to their climates
+  static ClimateTable* table = new ClimateTable;
+  return *table;
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 Atmosphere::Atmosphere(const Climate& climate)
 ///////////////////////////////////////////////////////////////////////////////
-  : m_temperature(climate.temperature(get_first<Season>())),
+  : m_own_slot(new TileSlot),
+    m_slot(*m_own_slot),
+    m_dewpoint(-1u),
+    m_wind(climate.wind(get_first<Season>())),
+    m_climate(climate)
+{
+  init();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Atmosphere::Atmosphere(const Climate& climate, const TileSlot& slot)
+///////////////////////////////////////////////////////////////////////////////
+  : m_own_slot(),
+    m_slot(slot),
     m_dewpoint(-1u),
-    m_precip(climate.precip(get_first<Season>())),
-    m_pressure(NORMAL_PRESSURE),
     m_wind(climate.wind(get_first<Season>())),
     m_climate(climate)
 {
+  init();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Atmosphere::init()
+///////////////////////////////////////////////////////////////////////////////
+{
+  m_slot.temperature() = m_climate.temperature(get_first<Season>());
+  m_slot.precip()      = m_climate.precip(get_first<Season>());
+  m_slot.pressure()    = NORMAL_PRESSURE;
   m_dewpoint = compute_dewpoint();
 }
 
@@ -48,7 +192,7 @@ int Atmosphere::compute_dewpoint() const
 ///////////////////////////////////////////////////////////////////////////////
 {
   // TODO - Function of temp and precip probably
-  return m_temperature - 20;
+  return temperature() - 20;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -63,24 +207,19 @@ bool Atmosphere::is_atmospheric(DrawMode mode)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void Atmosphere::cycle_turn(const std::vector<std::shared_ptr<const Anomaly>>& anomalies,
+void Atmosphere::cycle_turn(const AnomalyField& anomalies,
                             const Location& location,
                             Season season)
 ///////////////////////////////////////////////////////////////////////////////
 {
-  // Gather all modifiers from all anomalies
-  float precip_modifier = 1.0;
-  int temp_modifier = 0;
-  int pressure_modifier = 0;
-  for (auto anomaly : anomalies) {
-    precip_modifier *= anomaly->precip_effect(location);
-    temp_modifier += anomaly->temp_effect(location);
-    pressure_modifier += anomaly->pressure_effect(location);
-  }
+  // Gather the combined modifiers of all anomalies
+  const float precip_modifier = anomalies.precip_effect(location);
+  const int temp_modifier     = anomalies.temp_effect(location);
+  const int pressure_modifier = anomalies.pressure_effect(location);
 
-  m_temperature = m_climate.temperature(season) + temp_modifier;
-  m_pressure    = NORMAL_PRESSURE + pressure_modifier;
-  m_precip    = m_climate.precip(season) * precip_modifier;
+  m_slot.temperature() = m_climate.temperature(season) + temp_modifier;
+  m_slot.pressure()    = NORMAL_PRESSURE + pressure_modifier;
+  m_slot.precip()      = m_climate.precip(season) * precip_modifier;
 
   m_dewpoint = compute_dewpoint();
 
@@ -95,10 +234,10 @@ xmlNodePtr Atmosphere::to_xml()
   xmlNodePtr Atmosphere_node = xmlNewNode(nullptr, BAD_CAST "Atmosphere");
 
   std::ostringstream m_temperature_oss, m_dewpoint_oss, m_precip_oss, m_pressure_oss, m_wind_oss;
-  m_temperature_oss << m_temperature;
+  m_temperature_oss << temperature();
   m_dewpoint_oss << m_dewpoint;
-  m_precip_oss << m_precip;
-  m_pressure_oss << m_pressure;
+  m_precip_oss << precip();
+  m_pressure_oss << pressure();
   m_wind_oss << m_wind;
   xmlNewChild(Atmosphere_node, nullptr, BAD_CAST "m_temperature", BAD_CAST m_temperature_oss.str().c_str());
   xmlNewChild(Atmosphere_node, nullptr, BAD_CAST "m_dewpoint", BAD_CAST m_dewpoint_oss.str().c_str());
@@ -109,6 +248,24 @@ xmlNodePtr Atmosphere::to_xml()
   return Atmosphere_node;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void Atmosphere::save(SnapshotWriter& out) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  out.write(m_dewpoint);
+  out.write(m_wind.m_speed);
+  out.write(m_wind.m_direction);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Atmosphere::load(SnapshotReader& in)
+///////////////////////////////////////////////////////////////////////////////
+{
+  m_dewpoint         = in.read<int>();
+  m_wind.m_speed     = in.read<unsigned>();
+  m_wind.m_direction = in.read_enum<Direction>();
+}
+
 /*****************************************************************************/
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -124,35 +281,60 @@ Anomaly::Anomaly(AnomalyCategory category,
 {}
 
 ///////////////////////////////////////////////////////////////////////////////
-std::shared_ptr<const Anomaly> Anomaly::generate_anomaly(AnomalyCategory category,
-                                                         const Location& location,
-                                                         const World& world)
+bool Anomaly::generate_anomaly(AnomalyCategory category,
+                               const Location& location,
+                               const World& world,
+                               float roll,
+                               std::vector<Anomaly>& out)
 ///////////////////////////////////////////////////////////////////////////////
 {
-  const int intensity = GENERATE_ANOMALY_INTENSITY_FUNC();
+  const int intensity = GENERATE_ANOMALY_INTENSITY_FUNC(roll);
   const unsigned area = world.height() * world.width();
 
   if (intensity != 0) {
-    return std::shared_ptr<const Anomaly>(new Anomaly(category, intensity, location, area));
+    out.push_back(Anomaly(category, intensity, location, area));
+    return true;
   }
   else {
-    return nullptr;
+    return false;
   }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-float Anomaly::precip_effect(const Location& location) const
+float Anomaly::anomaly_roll(float unit_roll)
 ///////////////////////////////////////////////////////////////////////////////
 {
-  // TODO - In all effect methods, need a more sophisticated model for
-  // determining an anomaly's effect on a location. For the moment, anomalies
-  // only affect the immediate location.
+  // Both bands are ANOMALY_ROLL_BAND wide; the positive one ends at 1%
+  const float band_roll = 2 * (unit_roll < 0.5 ? unit_roll : unit_roll - 0.5) * ANOMALY_ROLL_BAND;
+  return unit_roll < 0.5 ? band_roll : 0.01 - band_roll;
+}
 
-  if (m_category != PRECIP_ANOMALY || m_location != location) {
+///////////////////////////////////////////////////////////////////////////////
+float Anomaly::falloff(const Location& location) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  const unsigned radius = this->radius();
+  const unsigned row_dist = std::abs(int(location.row) - int(m_location.row));
+  const unsigned col_dist = std::abs(int(location.col) - int(m_location.col));
+
+  if (row_dist > radius || col_dist > radius) {
+    return 0.0;
+  }
+  else {
+    const unsigned width = radius + 1;
+    return float((width - row_dist) * (width - col_dist)) / (width * width);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float Anomaly::precip_effect(const Location& location) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  if (m_category != PRECIP_ANOMALY) {
     return 1.0; // no effect
   }
   else {
-    return PRECIP_CHANGE_FUNC(m_intensity);
+    return PRECIP_CHANGE_FUNC(m_intensity * falloff(location));
   }
 }
 
@@ -160,11 +342,11 @@ float Anomaly::precip_effect(const Location& location) const
 int Anomaly::temp_effect(const Location& location) const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  if (m_category != TEMPERATURE_ANOMALY || m_location != location) {
+  if (m_category != TEMPERATURE_ANOMALY) {
     return 0; // no effect
   }
   else {
-    return TEMPERATURE_CHANGE_FUNC(m_intensity);
+    return TEMPERATURE_CHANGE_FUNC(m_intensity * falloff(location));
   }
 }
 
@@ -172,11 +354,11 @@ int Anomaly::temp_effect(const Location& location) const
 int Anomaly::pressure_effect(const Location& location) const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  if (m_category != PRESSURE_ANOMALY || m_location != location) {
+  if (m_category != PRESSURE_ANOMALY) {
     return 0; // no effect
   }
   else {
-    return PRESSURE_CHANGE_FUNC(m_intensity);
+    return PRESSURE_CHANGE_FUNC(m_intensity * falloff(location));
   }
 }
 
@@ -212,6 +394,152 @@ xmlNodePtr Anomaly::to_xml() const
   return Anomaly_node;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void Anomaly::save(SnapshotWriter& out) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  out.write(m_category);
+  out.write(m_intensity);
+  out.write(m_location);
+  out.write(m_world_area);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Anomaly Anomaly::load(SnapshotReader& in)
+///////////////////////////////////////////////////////////////////////////////
+{
+  const AnomalyCategory category = in.read_enum<AnomalyCategory>();
+  const int intensity            = in.read<int>();
+  const Location location        = in.read_location();
+  const unsigned world_area      = in.read<unsigned>();
+
+  RequireUser(intensity != 0 && std::abs(intensity) <= int(MAX_INTENSITY),
+              "Corrupt snapshot, bad anomaly intensity " << intensity);
+
+  return Anomaly(category, intensity, location, world_area);
+}
+
+/*****************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////////
+AnomalyField::AnomalyField(unsigned width, unsigned height)
+///////////////////////////////////////////////////////////////////////////////
+  : m_width(width),
+    m_height(height),
+    m_scale(1.0),
+    m_rasters(size<AnomalyCategory>()),
+    m_scratch()
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void AnomalyField::compute(Span<const Anomaly> anomalies, ThreadPool& pool)
+///////////////////////////////////////////////////////////////////////////////
+{
+  const unsigned radius = Anomaly::AFFECTED_RADIUS_FUNC(m_width * m_height);
+  const unsigned box_width = radius + 1;
+  m_scale = 1.0 / (box_width * box_width);
+
+  for (std::vector<int>& raster : m_rasters) {
+    raster.clear();
+  }
+
+  // Splat. Only categories that occur this turn get a raster.
+  for (const Anomaly& anomaly : anomalies) {
+    std::vector<int>& raster = m_rasters[anomaly.category()];
+    if (raster.empty()) {
+      raster.assign(m_width * m_height, 0);
+    }
+    const Location location = anomaly.location();
+    raster[location.row * m_width + location.col] += anomaly.intensity();
+  }
+
+  if (radius > 0) {
+    for (std::vector<int>& raster : m_rasters) {
+      if (!raster.empty()) {
+        blur(raster, radius / 2, pool);
+      }
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AnomalyField::blur(std::vector<int>& raster, unsigned box_radius, ThreadPool& pool)
+///////////////////////////////////////////////////////////////////////////////
+{
+  // A box pass replaces every value with the sum of the values within
+  // box_radius of it, using a running sum. Values off the map are 0, but the
+  // first pass's results spill box_radius past the edges and the second
+  // pass needs them, so the first pass writes to a padded buffer.
+  const int r = box_radius;
+  const int width = m_width, height = m_height;
+  int* const data = raster.data();
+
+  // Rows, in place
+  pool.parallel_for(0, height, [=](unsigned row_begin, unsigned row_end) {
+    std::vector<int> padded(width + 2 * r);
+    for (unsigned row = row_begin; row < row_end; ++row) {
+      int* values = data + row * width;
+
+      int sum = 0;
+      for (int col = -r; col < width + r; ++col) {
+        if (col + r < width) {
+          sum += values[col + r];
+        }
+        padded[col + r] = sum;
+        if (col - r >= 0) {
+          sum -= values[col - r];
+        }
+      }
+
+      sum = std::accumulate(padded.begin(), padded.begin() + 2 * r, 0);
+      for (int col = 0; col < width; ++col) {
+        sum += padded[col + 2 * r];
+        values[col] = sum;
+        sum -= padded[col];
+      }
+    }
+  });
+
+  // Columns. Whole rows are added to and subtracted from a row of running
+  // sums so the inner loops stay contiguous.
+  m_scratch.resize((height + 2 * r) * width);
+  int* const padded = m_scratch.data();
+  pool.parallel_for(0, width, [=](unsigned col_begin, unsigned col_end) {
+    const unsigned n = col_end - col_begin;
+    std::vector<int> sums(n, 0);
+    auto add_row = [&sums, n](const int* row_values, int sign) {
+      for (unsigned i = 0; i < n; ++i) {
+        sums[i] += sign * row_values[i];
+      }
+    };
+
+    const int* values = data + col_begin;
+    int* padded_values = padded + col_begin;
+    for (int row = -r; row < height + r; ++row) {
+      if (row + r < height) {
+        add_row(values + (row + r) * width, 1);
+      }
+      std::copy(sums.begin(), sums.end(), padded_values + (row + r) * width);
+      if (row - r >= 0) {
+        add_row(values + (row - r) * width, -1);
+      }
+    }
+
+    std::fill(sums.begin(), sums.end(), 0);
+    for (int row = 0; row < 2 * r; ++row) {
+      add_row(padded_values + row * width, 1);
+    }
+    int* out = data + col_begin;
+    for (int row = 0; row < height; ++row) {
+      add_row(padded_values + (row + 2 * r) * width, 1);
+      std::copy(sums.begin(), sums.end(), out + row * width);
+      add_row(padded_values + row * width, -1);
+    }
+  });
+}
+
+/*****************************************************************************/
+
 ///////////////////////////////////////////////////////////////////////////////
 std::ostream& operator<<(std::ostream& out, Wind const& wind)
 ///////////////////////////////////////////////////////////////////////////////
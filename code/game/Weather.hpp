@@ -4,9 +4,15 @@
 #include "DrawMode.hpp"
 #include "BaalCommon.hpp"
 #include "Time.hpp"
+#include "TileColumns.hpp"
 
 #include <iosfwd>
 #include <vector>
+#include <array>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <cmath>
 #include <libxml/parser.h>
 
 // This file contains the classes having to do with Weather. The
@@ -41,6 +47,10 @@ namespace baal {
 
 class World;
 class Anomaly;
+class AnomalyField;
+class ThreadPool;
+class SnapshotWriter;
+class SnapshotReader;
 
 struct Wind
 {
@@ -89,28 +99,29 @@ struct Wind
  * prevailing wind.
  *
  * This is different from season to season.
+ *
+ * Climates are identical across large regions, so tiles do not own one;
+ * they refer to a shared record from the ClimateTable.
  */
 class Climate
 {
  public:
-  Climate(std::vector<int> const& temperature,
-          std::vector<float> const& precip,
-          std::vector<Wind> const& wind)
+  typedef std::array<int,   SeasonLAST> Temperatures;
+  typedef std::array<float, SeasonLAST> Precips;
+  typedef std::array<Wind,  SeasonLAST> Winds;
+
+  Climate(Temperatures const& temperature,
+          Precips const& precip,
+          Winds const& wind)
     : m_temperature(temperature),
       m_precip(precip),
-      m_wind(wind)
-  {
-    const size_t num_seasons = baal::size<Season>();
-
-    Require(m_temperature.size() == num_seasons, "Wrong number of temperatures " << m_temperature.size());
-    Require(m_precip.size()      == num_seasons, "Wrong number of precip "       << m_precip.size());
-    Require(m_wind.size()        == num_seasons, "Wrong number of wind "         << m_wind.size());
-  }
-
-  ~Climate() = default;
+      m_wind(wind),
+      m_id(INVALID_ID)
+  {}
 
-  Climate(const Climate&) = delete;
-  Climate& operator=(const Climate&) = delete;
+  Climate(std::vector<int> const& temperature,
+          std::vector<float> const& precip,
+          std::vector<Wind> const& wind);
 
   int temperature(Season season) const { return m_temperature[season]; }
 
@@ -118,55 +129,133 @@ class Climate
 
   Wind wind(Season season) const { return m_wind[season]; }
 
-  xmlNodePtr to_xml();
+  // Position in the ClimateTable, INVALID_ID if this climate was not interned
+  unsigned id() const { return m_id; }
+
+  bool operator==(Climate const& rhs) const
+  {
+    return m_temperature == rhs.m_temperature &&
+           m_precip      == rhs.m_precip &&
+           m_wind        == rhs.m_wind;
+  }
+
+  std::size_t hash() const;
+
+  xmlNodePtr to_xml() const;
+
+  void save(SnapshotWriter& out) const;
+
+  // Returns the interned record
+  static const Climate& load(SnapshotReader& in);
+
+  static constexpr unsigned INVALID_ID = -1u;
 
  private:
-  std::vector<int>   m_temperature; // in farenheit
-  std::vector<float> m_precip;      // in inches/season
-  std::vector<Wind>  m_wind;        // prevailing wind
+  Temperatures m_temperature; // in farenheit
+  Precips      m_precip;      // in inches/season
+  Winds        m_wind;        // prevailing wind
+  unsigned     m_id;
+
+  friend class ClimateTable;
+};
+
+/**
+ * Process-wide table of distinct climates. Tiles hold references to the
+ * records in here instead of owning a Climate each.
+ *
+ * Records are never removed or moved, so references and ids stay valid for
+ * the life of the process and can be shared between concurrently running
+ * engines. Interning is thread safe; reading a record through a reference
+ * needs no locking.
+ */
+class ClimateTable
+{
+ public:
+  /**
+   * Return the record equal to climate, adding it if this is the first time
+   * it has been seen
+   */
+  static const Climate& intern(Climate const& climate);
+
+  static const Climate& intern(Climate::Temperatures const& temperature,
+                               Climate::Precips const& precip,
+                               Climate::Winds const& wind)
+  { return intern(Climate(temperature, precip, wind)); }
+
+  static const Climate& get(unsigned id);
+
+  // Number of distinct climates interned so far
+  static std::size_t size();
+
+ private:
+  struct Hash
+  {
+    std::size_t operator()(Climate const& climate) const { return climate.hash(); }
+  };
+
+  ClimateTable() = default;
+
+  static ClimateTable& instance();
+
+  std::mutex                                  m_mutex;
+  std::deque<Climate>                         m_records; // indexed by id
+  std::unordered_map<Climate, unsigned, Hash> m_ids;
 };
 
 /**
  * Every tile has atmosphere above it. Atmosphere has dewpoint,
  * temperature, wind vector, and pressure.
+ *
+ * Temperature, precip, and pressure live in the owning tile's TileSlot.
  */
 class Atmosphere
 {
  public:
+  // Stand-alone atmosphere with private storage
   Atmosphere(const Climate& climate);
 
+  // Atmosphere of a tile, stored in the tile's slot
+  Atmosphere(const Climate& climate, const TileSlot& slot);
+
   ~Atmosphere() = default;
 
   Atmosphere(const Atmosphere&) = delete;
   Atmosphere& operator=(const Atmosphere&) = delete;
 
-  int temperature() const { return m_temperature; }
+  int temperature() const { return m_slot.temperature(); }
 
   int dewpoint() const { return m_dewpoint; }
 
-  float precip() const { return m_precip; }
+  float precip() const { return m_slot.precip(); }
 
-  unsigned pressure() const { return m_pressure; }
+  unsigned pressure() const { return m_slot.pressure(); }
 
   Wind wind() const { return m_wind; }
 
   static bool is_atmospheric(DrawMode mode);
 
   // Based on season and anomalies, initialize self
-  void cycle_turn(const std::vector<std::shared_ptr<const Anomaly>>& anomalies,
+  void cycle_turn(const AnomalyField& anomalies,
                   const Location& location,
                   Season season);
 
   xmlNodePtr to_xml();
 
+  // Fields kept in the slot are saved with the World's columns
+  void save(SnapshotWriter& out) const;
+
+  void load(SnapshotReader& in);
+
   static const unsigned NORMAL_PRESSURE = 1000;
 
  private:
+  void init();
+
   int compute_dewpoint() const;
 
   // Interface for friend spells
 
-  void set_temperature(int new_temp) { m_temperature = new_temp; }
+  void set_temperature(int new_temp) { m_slot.temperature() = new_temp; }
 
   void set_wind(const Wind& wind) { m_wind = wind; }
 
@@ -178,12 +267,11 @@ class Atmosphere
 
   // Members
 
-  int            m_temperature; // in farenheit
-  int            m_dewpoint;    // in farenheit
-  float          m_precip;    // in inches, most recent season
-  unsigned       m_pressure;    // in millibars
-  Wind           m_wind;
-  const Climate& m_climate;
+  std::unique_ptr<TileSlot> m_own_slot;
+  const TileSlot&           m_slot;
+  int                       m_dewpoint; // in farenheit
+  Wind                      m_wind;
+  const Climate&            m_climate;
 };
 
 /**
@@ -198,17 +286,32 @@ class Anomaly
  public:
 
   /**
-   * Generates an anomaly. Returns nullptr if the dice roll did not
-   * merit the creation of an anomaly.
+   * Rolls for an anomaly with a caller-supplied uniform roll in [0, 1). If
+   * the roll merits one, appends it to out and returns true. The World
+   * draws rolls from counter_rand so that anomaly generation is
+   * reproducible and can run in parallel.
    */
-  static std::shared_ptr<const Anomaly> generate_anomaly(AnomalyCategory category,
-                                                         const Location& location,
-                                                         const World& world);
+  static bool generate_anomaly(AnomalyCategory category,
+                               const Location& location,
+                               const World& world,
+                               float roll,
+                               std::vector<Anomaly>& out);
 
-  ~Anomaly() = default;
+  /**
+   * Map a uniform roll in [0, 1) onto the rolls that produce an anomaly,
+   * keeping their relative likelihood. So generate_anomaly(..., anomaly_roll(u))
+   * is distributed like generate_anomaly(..., u) given that an anomaly was
+   * produced. Lets callers decide where anomalies occur first (each roll
+   * produces one with ANOMALY_PROBABILITY) and then only roll for those.
+   */
+  static float anomaly_roll(float unit_roll);
 
-  Anomaly(const Anomaly&) = delete;
-  Anomaly& operator=(const Anomaly&) = delete;
+  /**
+   * Return the fraction of this anomaly's intensity that is felt at a
+   * location: 1 at the epicenter, falling off linearly along each axis to
+   * 0 beyond radius().
+   */
+  float falloff(const Location& location) const;
 
   /**
    * Return this anomaly's effect on a location as a % of
@@ -230,6 +333,10 @@ class Anomaly
 
   xmlNodePtr to_xml() const;
 
+  void save(SnapshotWriter& out) const;
+
+  static Anomaly load(SnapshotReader& in);
+
   // Getters
 
   AnomalyCategory category() const { return m_category; }
@@ -238,8 +345,20 @@ class Anomaly
 
   Location location() const { return m_location; }
 
+  /**
+   * Return how many tiles away from its epicenter this anomaly can
+   * still have an effect.
+   */
+  unsigned radius() const { return AFFECTED_RADIUS_FUNC(m_world_area); }
+
   static const unsigned MAX_INTENSITY = 3; // anomalies are on a scale from +/- 1 -> MAX_INTENSITY
 
+  // GENERATE_ANOMALY_INTENSITY_FUNC scales the roll to a percentage but its
+  // thresholds are fractions, so only unit rolls in [0, ANOMALY_ROLL_BAND)
+  // (negative) or just under 1% (positive) produce anomalies
+  static constexpr float ANOMALY_ROLL_BAND   = MAX_INTENSITY / 10000.0;
+  static constexpr float ANOMALY_PROBABILITY = 2 * ANOMALY_ROLL_BAND;
+
  private:
   // Members
   Anomaly(AnomalyCategory category,
@@ -252,24 +371,34 @@ class Anomaly
   Location        m_location;
   unsigned        m_world_area;
 
-  static float PRECIP_CHANGE_FUNC(int intensity)
+  // Change functions take the intensity felt at a tile, which is fractional
+  // away from the epicenter and summed over overlapping anomalies
+
+  static float PRECIP_CHANGE_FUNC(float intensity)
   {
     // Returns a multiplier on average precip
     // (max - 1 / max)^(-intensity)
     return std::pow(float(MAX_INTENSITY - 1) / MAX_INTENSITY, -intensity);
   }
 
-  static int TEMPERATURE_CHANGE_FUNC(int intensity)
-  { return 7 * intensity; }
+  static unsigned AFFECTED_RADIUS_FUNC(unsigned world_area)
+  {
+    // Grows with the world's linear size; small worlds only feel anomalies
+    // at the epicenter. Always even since AnomalyField computes the falloff
+    // as two box blurs of half this radius.
+    return 2 * static_cast<unsigned>(std::sqrt(float(world_area)) / 64);
+  }
+
+  static int TEMPERATURE_CHANGE_FUNC(float intensity)
+  { return std::lround(7 * intensity); }
 
-  static int PRESSURE_CHANGE_FUNC(int intensity)
-  { return 15 * intensity; }
+  static int PRESSURE_CHANGE_FUNC(float intensity)
+  { return std::lround(15 * intensity); }
 
-  static int GENERATE_ANOMALY_INTENSITY_FUNC()
+  static int GENERATE_ANOMALY_INTENSITY_FUNC(float unit_roll)
   {
-    // Generate random float 0.0 -> 100.0
-    float roll = (float(std::rand()) /
-                  float(RAND_MAX)) * 100.0;
+    // Scale random float to 0.0 -> 100.0
+    float roll = unit_roll * 100.0;
 
     const float negative_anom = MAX_INTENSITY / 100.0;
     const float positive_anom = (100 - MAX_INTENSITY) / 100.0;
@@ -297,6 +426,62 @@ class Anomaly
 
     return intensity;
   }
+
+  friend class AnomalyField;
+};
+
+/**
+ * The combined effect of a turn's anomalies on every tile.
+ *
+ * An anomaly's falloff (see Anomaly::falloff) is a tent in each axis, and a
+ * tent is a box convolved with itself. So rather than have every tile visit
+ * every anomaly within range, compute() splats each category's epicenter
+ * intensities into an integer raster and box-blurs it twice along rows and
+ * twice along columns with running sums. That costs the same for any radius
+ * and gives exactly the sum of the individual falloffs.
+ */
+class AnomalyField
+{
+ public:
+  AnomalyField(unsigned width, unsigned height);
+
+  AnomalyField(const AnomalyField&) = delete;
+  AnomalyField& operator=(const AnomalyField&) = delete;
+
+  /**
+   * Rebuild the field from a turn's anomalies
+   */
+  void compute(Span<const Anomaly> anomalies, ThreadPool& pool);
+
+  /**
+   * Total intensity of a category of anomaly felt at a location
+   */
+  float intensity(AnomalyCategory category, const Location& location) const
+  {
+    Assert(location.row < m_height && location.col < m_width, "Out of bounds");
+    const std::vector<int>& raster = m_rasters[category];
+    return raster.empty() ? 0.0 : raster[location.row * m_width + location.col] * m_scale;
+  }
+
+  // Combined effects at a location; see the matching Anomaly methods
+
+  float precip_effect(const Location& location) const
+  { return Anomaly::PRECIP_CHANGE_FUNC(intensity(PRECIP_ANOMALY, location)); }
+
+  int temp_effect(const Location& location) const
+  { return Anomaly::TEMPERATURE_CHANGE_FUNC(intensity(TEMPERATURE_ANOMALY, location)); }
+
+  int pressure_effect(const Location& location) const
+  { return Anomaly::PRESSURE_CHANGE_FUNC(intensity(PRESSURE_ANOMALY, location)); }
+
+ private:
+  void blur(std::vector<int>& raster, unsigned box_radius, ThreadPool& pool);
+
+  unsigned m_width;
+  unsigned m_height;
+  float    m_scale; // undoes the blur's gain, 1 / (box width)^2
+  std::vector<std::vector<int> > m_rasters; // by category, row-major; empty if no anomalies
+  std::vector<int> m_scratch; // column pass, padded by the box radius
 };
 
 }
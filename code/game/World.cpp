@@ -1,32 +1,266 @@
 #include "World.hpp"
 #include "City.hpp"
+#include "BaalMath.hpp"
+#include "Snapshot.hpp"
+#include "Geology.hpp"
+#include "Engine.hpp"
+#include "Configuration.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <iomanip>
+#include <sstream>
+#include <unordered_map>
 
 namespace baal {
 
+constexpr unsigned World::CHUNK_SIZE;
+constexpr unsigned World::MAX_DIMENSION;
+constexpr unsigned World::CITY_ACTIVE_RADIUS;
+
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned configured_num_threads(const Configuration& config)
+///////////////////////////////////////////////////////////////////////////////
+{
+  // Sized before the world is generated, since generation uses the pool too
+  const std::string& threads_config = config.get_threads_config();
+  if (threads_config.empty()) {
+    return ThreadPool::default_num_threads();
+  }
+
+  unsigned num_threads = 0;
+  std::istringstream in(threads_config);
+  in >> num_threads;
+  RequireUser(threads_config.find_first_not_of("0123456789") == std::string::npos &&
+              !in.fail() && num_threads > 0,
+              "Invalid number of threads: " << threads_config);
+  return num_threads;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <class TileT>
+void cycle_tiles_of_type(const std::vector<unsigned>& indices,
+                         const std::vector<WorldTile*>& tiles,
+                         const AnomalyField& anomaly_field,
+                         Season season)
+///////////////////////////////////////////////////////////////////////////////
+{
+  // The qualified call resolves statically; TileT's whole cycle_turn chain
+  // runs without a virtual dispatch.
+  for (unsigned idx : indices) {
+    TileT& tile = static_cast<TileT&>(*tiles[idx]);
+    const Location location = tile.location();
+    tile.TileT::cycle_turn(anomaly_field,
+                           location,
+                           season);
+  }
+}
+
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 World::World(unsigned width, unsigned height, Engine& engine)
 ///////////////////////////////////////////////////////////////////////////////
   : m_width(width),
     m_height(height),
+    m_tiles(width * height, nullptr),
+    m_columns(width * height),
+    m_shared_geologies(),
+    m_chunk_rows((height + CHUNK_SIZE - 1) / CHUNK_SIZE),
+    m_chunk_cols((width  + CHUNK_SIZE - 1) / CHUNK_SIZE),
+    m_chunk_tiles(m_chunk_rows * m_chunk_cols,
+                  std::vector<std::vector<unsigned> >(size<TileType>())),
+    m_chunk_turn(m_chunk_rows * m_chunk_cols, 0),
+    m_chunk_active(m_chunk_rows * m_chunk_cols, false),
+    m_active_chunks(),
+    m_settled_turn(0),
+    m_sleeping(true),
+    m_row_anomalies(height),
+    m_anomaly_field(width, height),
+    m_calm_field(width, height),
+    m_seed(DEFAULT_SEED),
+    m_thread_pool(new ThreadPool(configured_num_threads(engine.config()))),
+    m_cities(width, height),
+    m_city_sites(width, height),
     m_engine(engine)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+World::~World()
+///////////////////////////////////////////////////////////////////////////////
 {
-  for (unsigned i = 0; i < height; ++i) {
-    std::vector<WorldTile*> row(width, nullptr);
-    m_tiles.push_back(row);
+  for (WorldTile* tile : m_tiles) {
+    delete tile;
   }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-World::~World()
+void World::index_tiles()
 ///////////////////////////////////////////////////////////////////////////////
 {
-  for (unsigned row = 0; row < height(); ++row) {
-    for (unsigned col = 0; col < width(); ++col) {
-      delete m_tiles[row][col];
+  for (unsigned idx = 0; idx < m_tiles.size(); ++idx) {
+    const WorldTile* tile = m_tiles[idx];
+    Require(tile != nullptr, "Missing tile " << idx);
+    Require(tile_index(tile->location()) == idx, "Tile placed at wrong location");
+    m_chunk_tiles[chunk_of(tile->location())][tile->type()].push_back(idx);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Geology& World::share_geology(Geology* geology)
+///////////////////////////////////////////////////////////////////////////////
+{
+  m_shared_geologies.emplace_back(geology);
+  geology->m_shared = true;
+  return *geology;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void World::set_tile(const Location& location, WorldTile* tile)
+///////////////////////////////////////////////////////////////////////////////
+{
+  Require(in_bounds(location), "Out of bounds");
+  Require(tile->location() == location, "Tile placed at wrong location");
+
+  const unsigned idx = tile_index(location);
+  Require(m_tiles[idx] == nullptr, "Tile already set");
+
+  tile->bind(m_columns, idx);
+  m_tiles[idx] = tile;
+  m_chunk_tiles[chunk_of(location)][tile->type()].push_back(idx);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void World::set_num_threads(unsigned num_threads)
+///////////////////////////////////////////////////////////////////////////////
+{
+  RequireUser(num_threads > 0, "Need at least one thread");
+  m_thread_pool.reset(new ThreadPool(num_threads));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void World::set_sleeping(bool sleeping)
+///////////////////////////////////////////////////////////////////////////////
+{
+  if (!sleeping) {
+    catch_up_all();
+  }
+  m_sleeping = sleeping;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void World::generate_anomalies(unsigned row_begin, unsigned row_end)
+///////////////////////////////////////////////////////////////////////////////
+{
+  // Every (tile, category) pair independently gets an anomaly with
+  // probability ANOMALY_PROBABILITY. Nearly all rolls come up empty, so
+  // instead of rolling for each pair we draw the geometrically distributed
+  // gap to the next pair that gets one, then roll only that pair's
+  // intensity. Each row has its own random stream per turn.
+  const unsigned turn = m_time.turn();
+  const unsigned num_categories = size<AnomalyCategory>();
+  const unsigned row_slots = width() * num_categories;
+  const double log_miss = std::log1p(-double(Anomaly::ANOMALY_PROBABILITY));
+
+  for (unsigned row = row_begin; row < row_end; ++row) {
+    std::vector<Anomaly>& row_anomalies = m_row_anomalies[row];
+    row_anomalies.clear();
+
+    const std::uint64_t stream = (std::uint64_t(turn) << 32) | row;
+    std::uint64_t counter = 0;
+    auto next_gap = [&]() {
+      return std::floor(std::log1p(-double(counter_rand(m_seed, stream, counter++))) / log_miss);
+    };
+
+    for (double slot = next_gap(); slot < row_slots; slot += 1 + next_gap()) {
+      const unsigned idx = static_cast<unsigned>(slot);
+      const Location location(row, idx / num_categories);
+      const AnomalyCategory category = static_cast<AnomalyCategory>(idx % num_categories);
+
+      // anomaly_roll can land exactly on a band edge, which rounds to no
+      // anomaly; roll again in that case
+      while (!Anomaly::generate_anomaly(category,
+                                        location,
+                                        *this,
+                                        Anomaly::anomaly_roll(counter_rand(m_seed, stream, counter++)),
+                                        row_anomalies)) {}
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void World::cycle_chunk(unsigned chunk, const AnomalyField& anomaly_field, Season season) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  const std::vector<std::vector<unsigned> >& tiles_by_type = m_chunk_tiles[chunk];
+
+  for (TileType type : iterate<TileType>()) {
+    const std::vector<unsigned>& indices = tiles_by_type[type];
+    switch (type) {
+    case OCEAN:
+      cycle_tiles_of_type<OceanTile>(indices, m_tiles, anomaly_field, season);
+      break;
+    case MOUNTAIN:
+      cycle_tiles_of_type<MountainTile>(indices, m_tiles, anomaly_field, season);
+      break;
+    case DESERT:
+      cycle_tiles_of_type<DesertTile>(indices, m_tiles, anomaly_field, season);
+      break;
+    case TUNDRA:
+      cycle_tiles_of_type<TundraTile>(indices, m_tiles, anomaly_field, season);
+      break;
+    case HILLS:
+      cycle_tiles_of_type<HillsTile>(indices, m_tiles, anomaly_field, season);
+      break;
+    case PLAINS:
+      cycle_tiles_of_type<PlainsTile>(indices, m_tiles, anomaly_field, season);
+      break;
+    case LUSH:
+      cycle_tiles_of_type<LushTile>(indices, m_tiles, anomaly_field, season);
+      break;
+    default:
+      Require(false, "Unhandled tile type: " << type);
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void World::catch_up_chunk(unsigned chunk, unsigned turn) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  // The chunk slept through these turns because no anomaly reached it, so
+  // replaying them without anomalies gives exactly what simulating them
+  // would have
+  for (unsigned t = m_chunk_turn[chunk] + 1; t <= turn; ++t) {
+    cycle_chunk(chunk, m_calm_field, static_cast<Season>(t % size<Season>()));
+  }
+  m_chunk_turn[chunk] = std::max(m_chunk_turn[chunk], turn);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void World::catch_up_all() const
+///////////////////////////////////////////////////////////////////////////////
+{
+  for (unsigned chunk = 0; chunk < m_chunk_turn.size(); ++chunk) {
+    catch_up_chunk(chunk, m_settled_turn);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void World::mark_active_chunks(const Location& center, unsigned radius)
+///////////////////////////////////////////////////////////////////////////////
+{
+  const unsigned row_begin = center.row - std::min(center.row, radius);
+  const unsigned col_begin = center.col - std::min(center.col, radius);
+  const unsigned row_last  = std::min(m_height - 1, center.row + radius);
+  const unsigned col_last  = std::min(m_width - 1,  center.col + radius);
+
+  for (unsigned chunk_row = row_begin / CHUNK_SIZE; chunk_row <= row_last / CHUNK_SIZE; ++chunk_row) {
+    for (unsigned chunk_col = col_begin / CHUNK_SIZE; chunk_col <= col_last / CHUNK_SIZE; ++chunk_col) {
+      m_chunk_active[chunk_row * m_chunk_cols + chunk_col] = true;
     }
   }
 }
@@ -35,25 +269,24 @@ World::~World()
 void World::cycle_turn()
 ///////////////////////////////////////////////////////////////////////////////
 {
-  // Phase 1: Increment time
+  // Phase 1: Increment time. Spells cast last turn can be cast again,
+  // sleeping chunks included.
   ++m_time;
+  std::fill(m_columns.m_casted.begin(), m_columns.m_casted.end(), 0);
 
-  // Phase 2: Generate anomalies.
-  // TODO: How to handle overlapping anomalies of same category?
-  m_recent_anomalies.clear();
-  for (unsigned row = 0; row < height(); ++row) {
-    for (unsigned col = 0; col < width(); ++col) {
-      Location location(row, col);
-      for (AnomalyCategory category : iterate<AnomalyCategory>()) {
-        auto anomaly = Anomaly::generate_anomaly(category,
-                                                 location,
-                                                 *this);
-        if (anomaly) {
-          m_recent_anomalies.push_back(anomaly);
-        }
-      }
-    }
+  // Phase 2: Generate anomalies. Rows are generated in parallel, then
+  // gathered in row order.
+  // Overlapping anomalies of the same category add up.
+  m_thread_pool->parallel_for(0, height(),
+                              [this](unsigned row_begin, unsigned row_end) {
+    generate_anomalies(row_begin, row_end);
+  });
+
+  m_anomalies.clear();
+  for (const auto& row_anomalies : m_row_anomalies) {
+    m_anomalies.insert(m_anomalies.end(), row_anomalies.begin(), row_anomalies.end());
   }
+  m_anomaly_field.compute(m_anomalies, *m_thread_pool);
 
   // Phase 3 of World turn-cycle: Simulate the inter-turn (long-term) weather.
   // Every turn, the weather since the last turn will be randomly simulated.
@@ -61,14 +294,42 @@ void World::cycle_turn()
   // having the most extreme deviations from the normal climate and peripheral
   // tiles having smaller deviations from normal.
   // Abnormalilty types are: drought, moist, cold, hot, high/low pressure
-  for (unsigned row = 0; row < height(); ++row) {
-    for (unsigned col = 0; col < width(); ++col) {
-      Location location(row, col);
-      m_tiles[row][col]->cycle_turn(m_recent_anomalies,
-                                    location,
-                                    m_time.season());
+  // Each tile reads the combined anomaly effects at its location.
+  //
+  // Only chunks that something can perturb this turn are simulated: those
+  // an anomaly reaches and those near a city. The rest sleep; absent
+  // anomalies their turns are a deterministic function of season, so they
+  // are replayed only when someone looks at them (see catch_up). Tiles do
+  // not depend on one another here, so active chunks are split across
+  // threads, and within a chunk tiles are batched by type to avoid
+  // virtual dispatch.
+  std::fill(m_chunk_active.begin(), m_chunk_active.end(), !m_sleeping);
+  for (const Anomaly& anomaly : m_anomalies) {
+    mark_active_chunks(anomaly.location(), anomaly.radius());
+  }
+  for (const City* city : cities()) {
+    mark_active_chunks(city->location(), CITY_ACTIVE_RADIUS);
+  }
+
+  m_active_chunks.clear();
+  for (unsigned chunk = 0; chunk < m_chunk_active.size(); ++chunk) {
+    if (m_chunk_active[chunk]) {
+      m_active_chunks.push_back(chunk);
     }
   }
+
+  const unsigned turn = m_time.turn();
+  const Season season = m_time.season();
+  m_thread_pool->parallel_for(0, m_active_chunks.size(),
+                              [this, turn, season](unsigned begin, unsigned end) {
+    for (unsigned i = begin; i < end; ++i) {
+      const unsigned chunk = m_active_chunks[i];
+      catch_up_chunk(chunk, turn - 1);
+      cycle_chunk(chunk, m_anomaly_field, season);
+      m_chunk_turn[chunk] = turn;
+    }
+  });
+  m_settled_turn = turn;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -78,7 +339,7 @@ void World::place_city(const Location& location, std::string const& arg_name)
   std::string name;
   if (arg_name == "") {
     std::ostringstream out;
-    out << "City " << m_cities.size() + 1;
+    out << "City " << cities().size() + 1;
     name = out.str();
   }
   else {
@@ -88,22 +349,20 @@ void World::place_city(const Location& location, std::string const& arg_name)
   City* new_city = new City(name, location, m_engine);
   WorldTile& tile = get_tile(location);
   dynamic_cast<LandTile&>(tile).place_city(*new_city);
-  m_cities.push_back(new_city);
+  m_cities.insert(*new_city);
+  m_city_sites.invalidate_near_city(location);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void World::remove_city(City& city)
 ///////////////////////////////////////////////////////////////////////////////
 {
-  std::vector<City*>::iterator itr = std::find(m_cities.begin(),
-                                               m_cities.end(),
-                                               &city);
-  Require(itr != m_cities.end(),
-          "City '" << city.name() << "' not in m_cities");
-  m_cities.erase(itr);
+  m_cities.remove(city);
 
-  WorldTile& tile = get_tile(city.location());
+  const Location location = city.location();
+  WorldTile& tile = get_tile(location);
   dynamic_cast<LandTile&>(tile).remove_city();
+  m_city_sites.invalidate_near_city(location);
   delete &city;
 }
 
@@ -124,13 +383,15 @@ World::ValidNearbyTileRange World::valid_nearby_tile_range(const Location& cente
 xmlNodePtr World::to_xml()
 ///////////////////////////////////////////////////////////////////////////////
 {
+  catch_up_all();
+
   xmlNodePtr World_node = xmlNewNode(nullptr, BAD_CAST "World");
 
   /*unsigned m_width;
   unsigned m_height;
-  std::vector<std::vector<WorldTile*> > m_tiles;
+  std::vector<WorldTile*> m_tiles;
   Time m_time;
-  std::vector<const Anomaly*> m_recent_anomalies;
+  std::vector<Anomaly> m_anomalies;
   std::vector<City*> m_cities;*/
 
   std::ostringstream width_oss;
@@ -144,7 +405,7 @@ xmlNodePtr World::to_xml()
   // I figure there's an easier Iterator here; not sure how to use it.
   for (unsigned int row = 0; row < m_height; row++) {
     for (unsigned int col = 0; col < m_width; col++) {
-      xmlNodePtr Tile_node = m_tiles[row][col]->to_xml();
+      xmlNodePtr Tile_node = m_tiles[tile_index(Location(row, col))]->to_xml();
       std::ostringstream row_oss, col_oss;
       row_oss << row;
       col_oss << col;
@@ -156,15 +417,157 @@ xmlNodePtr World::to_xml()
 
   xmlAddChild(World_node, m_time.to_xml());
 
-  for (auto anomaly : m_recent_anomalies) {
-    xmlAddChild(World_node, anomaly->to_xml());
+  for (const Anomaly& anomaly : m_anomalies) {
+    xmlAddChild(World_node, anomaly.to_xml());
   }
 
-  for (auto city : m_cities) {
+  for (auto city : cities()) {
     xmlAddChild(World_node, city->to_xml());
   }
 
   return World_node;
 }
 
+
+///////////////////////////////////////////////////////////////////////////////
+void World::save(SnapshotWriter& out) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  catch_up_all();
+
+  out.write(m_width);
+  out.write(m_height);
+  out.write(m_seed);
+  m_time.save(out);
+
+  // Many tiles can share a geology, so each distinct one is saved once,
+  // in the order tiles first refer to it, and tiles save its index
+  std::unordered_map<const Geology*, std::uint32_t> geology_index;
+  std::vector<const Geology*> geologies;
+  for (const WorldTile* tile : m_tiles) {
+    if (geology_index.emplace(&tile->geology(), geologies.size()).second) {
+      geologies.push_back(&tile->geology());
+    }
+  }
+
+  out.write<std::uint32_t>(geologies.size());
+  for (const Geology* geology : geologies) {
+    geology->save(out);
+  }
+
+  for (const WorldTile* tile : m_tiles) {
+    tile->save(out, geology_index[&tile->geology()]);
+  }
+
+  out.write<std::uint32_t>(m_anomalies.size());
+  for (const Anomaly& anomaly : m_anomalies) {
+    anomaly.save(out);
+  }
+
+  out.write<std::uint32_t>(cities().size());
+  for (const City* city : cities()) {
+    out.write(city->name());
+    out.write(city->location());
+    city->save(out);
+  }
+
+  // Hot fields go out last, as whole columns, so that loading them
+  // overwrites whatever tile construction and city placement put in the
+  // slots
+  out.write_array(m_columns.m_temperature);
+  out.write_array(m_columns.m_precip);
+  out.write_array(m_columns.m_pressure);
+  out.write_array(m_columns.m_soil_moisture);
+  out.write_array(m_columns.m_snowpack);
+  out.write_array(m_columns.m_infra_level);
+  out.write_array(m_columns.m_hp);
+  out.write_array(m_columns.m_casted);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::shared_ptr<World> World::load(SnapshotReader& in, Engine& engine)
+///////////////////////////////////////////////////////////////////////////////
+{
+  const unsigned width  = in.read<unsigned>();
+  const unsigned height = in.read<unsigned>();
+  RequireUser(width > 0 && height > 0 && width <= MAX_DIMENSION && height <= MAX_DIMENSION,
+              "Corrupt snapshot, bad world size " << width << "x" << height);
+
+  // Every tile takes at least its share of the hot columns, so a world
+  // bigger than what is left of the stream cannot be real; check before
+  // allocating it
+  const std::uint64_t min_bytes_per_tile =
+    sizeof(int) + sizeof(float) + sizeof(unsigned) + sizeof(float) +
+    sizeof(unsigned) + sizeof(unsigned) + sizeof(float) + sizeof(std::uint32_t);
+  RequireUser(std::uint64_t(width) * height * min_bytes_per_tile <= in.remaining(),
+              "Corrupt snapshot, world of " << width << "x" << height << " does not fit in it");
+
+  std::shared_ptr<World> world(new World(width, height, engine));
+  world->m_seed = in.read<std::uint64_t>();
+  world->m_time.load(in);
+  world->m_settled_turn = world->m_time.turn();
+  std::fill(world->m_chunk_turn.begin(), world->m_chunk_turn.end(), world->m_settled_turn);
+
+  const unsigned num_tiles = width * height;
+
+  // Tiles that shared a geology when saved share it again; the World owns
+  // every loaded geology
+  const std::uint32_t num_geologies = in.read<std::uint32_t>();
+  RequireUser(num_geologies > 0 && num_geologies <= num_tiles,
+              "Corrupt snapshot, " << num_geologies << " geologies for " << num_tiles << " tiles");
+  std::vector<Geology*> geologies;
+  geologies.reserve(num_geologies);
+  for (std::uint32_t i = 0; i < num_geologies; ++i) {
+    geologies.push_back(&world->share_geology(Geology::load(in)));
+  }
+
+  for (unsigned i = 0; i < num_tiles; ++i) {
+    std::unique_ptr<WorldTile> tile(WorldTile::load(in, geologies));
+    const Location location = tile->location();
+    RequireUser(world->in_bounds(location) && world->tile_index(location) == i,
+                "Corrupt snapshot, tile out of order at " << location);
+    world->set_tile(location, tile.release());
+  }
+
+  const std::uint32_t num_anomalies = in.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < num_anomalies; ++i) {
+    world->m_anomalies.push_back(Anomaly::load(in));
+    RequireUser(world->in_bounds(world->m_anomalies.back().location()),
+                "Corrupt snapshot, anomaly out of bounds");
+  }
+  world->m_anomaly_field.compute(world->m_anomalies, *world->m_thread_pool);
+
+  const std::uint32_t num_cities = in.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < num_cities; ++i) {
+    const std::string name  = in.read_string();
+    const Location location = in.read_location();
+    RequireUser(world->in_bounds(location) && world->get_tile(location).supports_city(),
+                "Corrupt snapshot, city cannot be at " << location);
+    world->place_city(location, name);
+    world->cities().back()->load(in);
+  }
+
+  TileColumns& columns = world->m_columns;
+  in.read_array(columns.m_temperature,   num_tiles);
+  in.read_array(columns.m_precip,        num_tiles);
+  in.read_array(columns.m_pressure,      num_tiles);
+  in.read_array(columns.m_soil_moisture, num_tiles);
+  in.read_array(columns.m_snowpack,      num_tiles);
+  in.read_array(columns.m_infra_level,   num_tiles);
+  in.read_array(columns.m_hp,            num_tiles);
+  in.read_array(columns.m_casted,        num_tiles);
+
+  const std::uint32_t valid_casts = (std::uint64_t(1) << SpellIdLAST) - 1;
+  for (std::uint32_t casted : columns.m_casted) {
+    RequireUser((casted & ~valid_casts) == 0, "Corrupt snapshot, unknown spell cast");
+  }
+
+  // The columns changed under the tiles; drop any yields cached meanwhile
+  for (unsigned& version : columns.m_yield_version) {
+    ++version;
+  }
+
+  return world;
+}
+
 }
@@ -2,23 +2,46 @@
 #define World_hpp
 
 #include "WorldTile.hpp"
+#include "Weather.hpp"
 #include "BaalExceptions.hpp"
 #include "BaalCommon.hpp"
 #include "Time.hpp"
 #include "City.hpp"
+#include "ThreadPool.hpp"
+#include "CitySiteField.hpp"
+#include "CityIndex.hpp"
 
 #include <vector>
+#include <memory>
+#include <cstdint>
 #include <iosfwd>
 #include <libxml/parser.h>
 #include <boost/iterator/filter_iterator.hpp>
 
 namespace baal {
 
-class Anomaly;
 class Engine;
+class SnapshotWriter;
+class SnapshotReader;
 
 /**
  * Represents the world.
+ *
+ * Tiles are indexed flat in row-major order. Only that index is
+ * contiguous: each tile is still its own heap object, reached through
+ * virtual calls. What is laid out contiguously are the fields of each
+ * tile that change every turn, which live in m_columns in the same order,
+ * so per-turn passes stream through the columns rather than chasing tiles.
+ *
+ * Turn cycling is spread over a thread pool. All randomness comes from
+ * counter-based streams keyed on (seed, tile, turn), so the outcome of a
+ * turn does not depend on the number of threads.
+ *
+ * The map is divided into CHUNK_SIZE x CHUNK_SIZE chunks. Chunks nothing
+ * can perturb are not simulated; they fall behind and are caught up,
+ * deterministically, the next time one of their tiles is looked at. Every
+ * access to tiles goes through get_tile (or catches up itself), so callers
+ * never see a sleeping chunk.
  */
 class World
 {
@@ -54,8 +77,9 @@ class World
    */
   const WorldTile& get_tile(const Location& location) const {
     Assert(in_bounds(location), "Out of bounds");
-    Assert(m_tiles[location.row][location.col] != nullptr, "Null");
-    return *(m_tiles[location.row][location.col]);
+    Assert(m_tiles[tile_index(location)] != nullptr, "Null");
+    catch_up(location);
+    return *(m_tiles[tile_index(location)]);
   }
 
   /**
@@ -63,23 +87,64 @@ class World
    */
   WorldTile& get_tile(const Location& location) {
     Assert(in_bounds(location), "Out of bounds");
-    Assert(m_tiles[location.row][location.col] != nullptr, "Null at (" << location.row << ", " << location.col << ")");
-    return *(m_tiles[location.row][location.col]);
+    Assert(m_tiles[tile_index(location)] != nullptr, "Null at (" << location.row << ", " << location.col << ")");
+    catch_up(location);
+    return *(m_tiles[tile_index(location)]);
   }
 
   unsigned width() const { return m_width; }
 
   unsigned height() const { return m_height; }
 
-  const std::vector<City*>& cities() const { return m_cities; }
+  const std::vector<City*>& cities() const { return m_cities.cities(); }
+
+  const CityIndex& city_index() const { return m_cities; }
 
   const Time& time() const { return m_time; }
 
-  const std::vector<std::shared_ptr<const Anomaly>> anomalies() const
-  { return m_recent_anomalies; }
+  /**
+   * This turn's anomalies; only valid until the next turn
+   */
+  Span<const Anomaly> anomalies() const { return m_anomalies; }
+
+  std::uint64_t seed() const { return m_seed; }
+
+  unsigned num_threads() const { return m_thread_pool->num_threads(); }
+
+  ThreadPool& thread_pool() const { return *m_thread_pool; }
+
+  /**
+   * How good a spot location is for a new city; cached between calls
+   */
+  float city_site_score(const Location& location)
+  {
+    // The cache reads yield versions straight from the columns
+    for (const Location& loc : valid_nearby_tile_range(location, CitySiteField::SITE_RADIUS)) {
+      catch_up(loc);
+    }
+    return m_city_sites.score(location, m_columns, m_engine);
+  }
+
+  /**
+   * True if location's chunk is behind; for diagnostics, since get_tile
+   * always catches up
+   */
+  bool is_asleep(const Location& location) const
+  { return m_chunk_turn[chunk_of(location)] != m_settled_turn; }
 
   // Modification API
 
+  void set_seed(std::uint64_t seed) { m_seed = seed; }
+
+  // The pool starts out sized by the configuration's threads config
+  void set_num_threads(unsigned num_threads);
+
+  // Chunks sleep by default. A world that does not let them simulates every
+  // chunk every turn; this is the reference sleeping must match.
+  void set_sleeping(bool sleeping);
+
+  bool sleeping() const { return m_sleeping; }
+
   void cycle_turn();
 
   void place_city(const Location& location, const std::string& name = "");
@@ -88,17 +153,88 @@ class World
 
   xmlNodePtr to_xml();
 
+  void save(SnapshotWriter& out) const;
+
+  static std::shared_ptr<World> load(SnapshotReader& in, Engine& engine);
+
   ValidNearbyTileRange valid_nearby_tile_range(const Location& center, unsigned radius = 1) const;
 
+  static constexpr std::uint64_t DEFAULT_SEED = 0;
+
+  static constexpr unsigned CHUNK_SIZE = 8;
+
+  // Largest width or height; keeps width * height well within unsigned
+  static constexpr unsigned MAX_DIMENSION = 1 << 15;
+
+  // Chunks this close to a city are simulated every turn; covers the tiles
+  // a city works and the sites it considers for settlers
+  static constexpr unsigned CITY_ACTIVE_RADIUS = 4;
+
  private:
 
+  unsigned tile_index(const Location& location) const
+  { return location.row * m_width + location.col; }
+
+  // Take ownership of a tile; for factories
+  void set_tile(const Location& location, WorldTile* tile);
+
+  // File tiles that a factory stored straight into m_tiles, which must be
+  // full, by chunk; for factories
+  void index_tiles();
+
+  // Take ownership of a geology that many tiles will refer to; for
+  // factories. Tiles do not delete shared geologies.
+  Geology& share_geology(Geology* geology);
+
+  void generate_anomalies(unsigned row_begin, unsigned row_end);
+
+  unsigned chunk_of(const Location& location) const
+  { return (location.row / CHUNK_SIZE) * m_chunk_cols + location.col / CHUNK_SIZE; }
+
+  void catch_up(const Location& location) const
+  {
+    const unsigned chunk = chunk_of(location);
+    if (m_chunk_turn[chunk] != m_settled_turn) {
+      catch_up_chunk(chunk, m_settled_turn);
+    }
+  }
+
+  // Replay a sleeping chunk's missed turns up to turn
+  void catch_up_chunk(unsigned chunk, unsigned turn) const;
+
+  void catch_up_all() const;
+
+  void cycle_chunk(unsigned chunk, const AnomalyField& anomaly_field, Season season) const;
+
+  void mark_active_chunks(const Location& center, unsigned radius);
+
   // Members
   unsigned m_width;
   unsigned m_height;
-  std::vector<std::vector<WorldTile*> > m_tiles;
+  std::vector<WorldTile*> m_tiles; // row-major; the tiles themselves are separate heap objects
+  TileColumns m_columns;
+  std::vector<std::unique_ptr<Geology> > m_shared_geologies;
+  unsigned m_chunk_rows;
+  unsigned m_chunk_cols;
+  std::vector<std::vector<std::vector<unsigned> > > m_chunk_tiles; // tile indices, by chunk then TileType
+  // Turn each chunk's tiles are current as of. Catching up happens behind
+  // const accessors, hence mutable.
+  mutable std::vector<unsigned> m_chunk_turn;
+  std::vector<bool> m_chunk_active;      // scratch for cycle_turn
+  std::vector<unsigned> m_active_chunks; // scratch for cycle_turn
+  unsigned m_settled_turn;               // turn of the last completed cycle_turn
+  bool m_sleeping;                       // whether quiet chunks may sleep
   Time m_time;
-  std::vector<std::shared_ptr<const Anomaly>> m_recent_anomalies;
-  std::vector<City*> m_cities;
+  // Turn-lifetime storage. Cleared, not freed, every turn so that after the
+  // first few turns cycling allocates nothing.
+  std::vector<Anomaly> m_anomalies;
+  std::vector<std::vector<Anomaly> > m_row_anomalies; // scratch for phase 2
+  AnomalyField m_anomaly_field;
+  AnomalyField m_calm_field; // never computed; no anomalies anywhere
+  std::uint64_t m_seed;
+  std::unique_ptr<ThreadPool> m_thread_pool;
+  CityIndex m_cities;
+  CitySiteField m_city_sites;
   Engine& m_engine;
 
   // Friend factories
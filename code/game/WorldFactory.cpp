@@ -37,12 +37,13 @@ std::shared_ptr<World> WorldFactory::create(Engine& engine)
   if (numeric) {
     return WorldFactoryHardcoded::create(world_config, engine);
   }
-  else if (world_config == GENERATED_WORLD) {
-    return WorldFactoryGenerated::create(engine);
-  }
   else if (is_baal_map_file(world_config)) {
     return WorldFactoryFromFile::create(world_config, engine);
   }
+  else if (world_config.compare(0, GENERATED_WORLD.size(), GENERATED_WORLD) == 0) {
+    // g[<width>x<height>][:<seed>]
+    return WorldFactoryGenerated::create(world_config, engine);
+  }
   else {
     RequireUser(false, "Invalid choice of world: " << world_config);
   }
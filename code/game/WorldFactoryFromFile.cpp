@@ -4,12 +4,26 @@
 #include "Geology.hpp"
 #include "City.hpp"
 
-#include <string.h>
+#include <utility>
 
 namespace baal {
 
 const std::string WorldFactoryFromFile::WORLD_FILE_EXT = ".baalmap";
 
+namespace {
+
+struct ReaderDeleter
+{
+  void operator()(xmlTextReaderPtr reader) const { xmlFreeTextReader(reader); }
+};
+
+struct XmlCharDeleter
+{
+  void operator()(xmlChar* str) const { xmlFree(str); }
+};
+
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 std::shared_ptr<World> WorldFactoryFromFile::create(const std::string& mapfilename,
                                                     Engine& engine)
@@ -24,161 +38,300 @@ std::shared_ptr<World> WorldFactoryFromFile::create(const std::string& mapfilena
 std::shared_ptr<World> WorldFactoryFromFile::load()
 ///////////////////////////////////////////////////////////////////////////////
 {
-  m_mapfile = xmlParseFile(m_mapfilename);
-  RequireUser(m_mapfile != nullptr,
-              "Map file " << m_mapfilename << " not parsed successfully.");
+  std::unique_ptr<xmlTextReader, ReaderDeleter> reader(
+    xmlReaderForFile(m_mapfilename, nullptr, XML_PARSE_NOBLANKS));
+  RequireUser(reader != nullptr, "Map file " << m_mapfilename << " could not be opened.");
+  m_reader = reader.get();
 
-  m_curr_node = xmlDocGetRootElement(m_mapfile);
-  if (m_curr_node == nullptr) {
-    xmlFreeDoc(m_mapfile);
-    RequireUser(false, "Map file " << m_mapfilename << " is empty.");
-  }
-  if (xmlStrcmp(m_curr_node->name, (const xmlChar *) "baalmap")) {
-    xmlFreeDoc(m_mapfile);
-    RequireUser(false, "Map file " << m_mapfilename << " is not a Baal map.");
+  // Find the root element
+  int rc = xmlTextReaderRead(m_reader);
+  while (rc == 1 && xmlTextReaderNodeType(m_reader) != XML_READER_TYPE_ELEMENT) {
+    rc = xmlTextReaderRead(m_reader);
   }
+  RequireUser(rc != -1, "Map file " << m_mapfilename << " not parsed successfully.");
+  RequireUser(rc == 1, "Map file " << m_mapfilename << " is empty.");
+  RequireUser(at("baalmap"), "Map file " << m_mapfilename << " is not a Baal map.");
 
-  int map_width = get_data_from_parent<int>("map_width");
-  int map_height = get_data_from_parent<int>("map_height");
+  unsigned map_width = 0, map_height = 0;
+  std::shared_ptr<World> world;
+  std::vector<std::pair<Location, std::string> > cities;
 
-  std::shared_ptr<World> world =
-    std::shared_ptr<World>(new World(map_width, map_height, m_engine));
-  m_curr_node = m_curr_node->xmlChildrenNode;
-  while (m_curr_node != nullptr) {
-    if (!xmlStrcmp(m_curr_node->name, (const xmlChar *)"tile")) {
-      int row = get_data_from_parent<int>("row");
-      int col = get_data_from_parent<int>("col");
-      world->m_tiles[row][col] = &parse_Tile(row, col);
+  const int root_depth = depth();
+  for (bool more = first_child(root_depth); more; more = next_sibling(root_depth)) {
+    if (at("map_width")) {
+      map_width = element_data<unsigned>();
+    }
+    else if (at("map_height")) {
+      map_height = element_data<unsigned>();
     }
-    else if (!xmlStrcmp(m_curr_node->name, (const xmlChar *)"city")) {
-      int row = get_data_from_parent<int>("row");
-      int col = get_data_from_parent<int>("col");
-      char* name = get_element("name");
-      LandTile* landtile = dynamic_cast<LandTile*>(world->m_tiles[row][col]);
-      RequireUser(landtile != nullptr,
-                  "Tried to place city at " << row << ", " << col <<
-                  "; which is not a landtile");
-      world->place_city(Location(row, col), name);
+    else if (at("tile")) {
+      if (!world) {
+        RequireUser(map_width > 0 && map_height > 0,
+                    "Map file " << m_mapfilename <<
+                    " must give map_width and map_height before any tile.");
+        world.reset(new World(map_width, map_height, m_engine));
+      }
+
+      std::unique_ptr<WorldTile> tile(parse_tile());
+      const Location location = tile->location();
+      RequireUser(world->in_bounds(location),
+                  "Tile at " << location << " is outside of the map.");
+      RequireUser(world->m_tiles[world->tile_index(location)] == nullptr,
+                  "Tile at " << location << " appears more than once.");
+      world->set_tile(location, tile.release());
     }
-    m_curr_node = m_curr_node->next;
+    else if (at("city")) {
+      // Cities are placed once every tile has been read
+      Location location;
+      std::string name;
+      const int city_depth = depth();
+      for (bool more_city = first_child(city_depth); more_city; more_city = next_sibling(city_depth)) {
+        if (at("row")) {
+          location.row = element_data<unsigned>();
+        }
+        else if (at("col")) {
+          location.col = element_data<unsigned>();
+        }
+        else if (at("name")) {
+          name = element_text();
+        }
+      }
+      cities.push_back(std::make_pair(location, name));
+    }
+  }
+
+  RequireUser(world, "Map file " << m_mapfilename << " has no tiles.");
+  for (const WorldTile* tile : world->m_tiles) {
+    RequireUser(tile != nullptr, "Map file " << m_mapfilename << " is missing tiles.");
+  }
+
+  for (const auto& city : cities) {
+    const Location& location = city.first;
+    RequireUser(world->in_bounds(location) && world->get_tile(location).supports_city(),
+                "Tried to place city at " << location << "; which cannot support a city");
+    world->place_city(location, city.second);
   }
 
+  m_reader = nullptr;
   return world;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-char* WorldFactoryFromFile::get_element(const char *elemname)
+bool WorldFactoryFromFile::first_child(int parent_depth)
+///////////////////////////////////////////////////////////////////////////////
+{
+  if (xmlTextReaderIsEmptyElement(m_reader)) {
+    return false;
+  }
+  return advance_to_child(xmlTextReaderRead(m_reader), parent_depth);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool WorldFactoryFromFile::next_sibling(int parent_depth)
 ///////////////////////////////////////////////////////////////////////////////
 {
-  xmlNodePtr curr_node = m_curr_node->xmlChildrenNode;
-  while (curr_node != nullptr) {
-    if (!xmlStrcmp(curr_node->name, (const xmlChar *)elemname)) {
-      return (char *)xmlNodeListGetString(m_mapfile,
-                                          curr_node->xmlChildrenNode,
-                                          1);
+  // Next skips whatever is left of the current child's subtree
+  return advance_to_child(xmlTextReaderNext(m_reader), parent_depth);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool WorldFactoryFromFile::advance_to_child(int rc, int parent_depth)
+///////////////////////////////////////////////////////////////////////////////
+{
+  // Skip text, comments, etc until we hit a child element or the parent's
+  // end tag
+  while (rc == 1) {
+    if (depth() <= parent_depth) {
+      return false;
+    }
+    if (depth() == parent_depth + 1 &&
+        xmlTextReaderNodeType(m_reader) == XML_READER_TYPE_ELEMENT) {
+      return true;
     }
-    curr_node = curr_node->next;
+    rc = xmlTextReaderRead(m_reader);
   }
-  RequireUser(false, "Could not find element named " << elemname << ".");
+
+  RequireUser(false, "Map file " << m_mapfilename << " not parsed successfully.");
+  return false;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-WorldTile& WorldFactoryFromFile::parse_Tile(int row, int col)
+bool WorldFactoryFromFile::at(const char* elemname) const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  // m_curr_node is tile
-  // Climate(int temperature, unsigned precip, Wind wind)
+  return xmlStrEqual(xmlTextReaderConstName(m_reader), BAD_CAST elemname);
+}
 
-  Location location(row, col);
-  char *type = get_element("type");
-  Climate& climate = get_Climate_from_parent();
-  Geology& geology = get_Geology_from_parent();
-  if (!strcmp(type, "OceanTile")) {
-    unsigned depth = get_data_from_parent<unsigned>("depth");
-    return *new OceanTile(location, depth, climate, geology);
+///////////////////////////////////////////////////////////////////////////////
+std::string WorldFactoryFromFile::element_text()
+///////////////////////////////////////////////////////////////////////////////
+{
+  std::unique_ptr<xmlChar, XmlCharDeleter> text(xmlTextReaderReadString(m_reader));
+  return text ? std::string(reinterpret_cast<const char*>(text.get())) : std::string();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+WorldTile* WorldFactoryFromFile::parse_tile()
+///////////////////////////////////////////////////////////////////////////////
+{
+  // Reader is on a tile element
+  Location location;
+  std::string type;
+  unsigned depth_or_elevation = 0;
+  const Climate* climate = nullptr;
+  std::unique_ptr<Geology> geology;
+
+  const int tile_depth = depth();
+  for (bool more = first_child(tile_depth); more; more = next_sibling(tile_depth)) {
+    if (at("row")) {
+      location.row = element_data<unsigned>();
+    }
+    else if (at("col")) {
+      location.col = element_data<unsigned>();
+    }
+    else if (at("type")) {
+      type = element_text();
+    }
+    else if (at("depth") || at("elevation")) {
+      depth_or_elevation = element_data<unsigned>();
+    }
+    else if (at("Climate")) {
+      climate = &parse_climate();
+    }
+    else if (at("Geology")) {
+      geology.reset(parse_geology());
+    }
   }
-  else if (!strcmp(type, "DesertTile")) {
-    unsigned elevation = get_data_from_parent<unsigned>("elevation");
-    return *new DesertTile(location, elevation, climate, geology);
+
+  RequireUser(climate, "Could not find Climate in tile at " << location);
+  RequireUser(geology, "Could not find Geology in tile at " << location);
+
+  WorldTile* tile = nullptr;
+  if (type == "OceanTile") {
+    tile = new OceanTile(location, depth_or_elevation, *climate, *geology);
   }
-  else if (!strcmp(type, "LushTile")) {
-    unsigned elevation = get_data_from_parent<unsigned>("elevation");
-    return *new LushTile(location, elevation, climate, geology);
+  else if (type == "DesertTile") {
+    tile = new DesertTile(location, depth_or_elevation, *climate, *geology);
   }
-  else if (!strcmp(type, "MountainTile")) {
-    unsigned elevation = get_data_from_parent<unsigned>("elevation");
-    return *new MountainTile(location, elevation, climate, geology);
+  else if (type == "LushTile") {
+    tile = new LushTile(location, depth_or_elevation, *climate, *geology);
   }
-  else if (!strcmp(type, "TundraTile")) {
-    unsigned elevation = get_data_from_parent<unsigned>("elevation");
-    return *new TundraTile(location, elevation, climate, geology);
+  else if (type == "MountainTile") {
+    tile = new MountainTile(location, depth_or_elevation, *climate, *geology);
   }
-  else if (!strcmp(type, "PlainsTile")) {
-    unsigned elevation = get_data_from_parent<unsigned>("elevation");
-    return *new PlainsTile(location, elevation, climate, geology);
+  else if (type == "TundraTile") {
+    tile = new TundraTile(location, depth_or_elevation, *climate, *geology);
   }
-  else if (!strcmp(type, "HillsTile")) {
-    unsigned elevation = get_data_from_parent<unsigned>("elevation");
-    return *new HillsTile(location, elevation, climate, geology);
+  else if (type == "PlainsTile") {
+    tile = new PlainsTile(location, depth_or_elevation, *climate, *geology);
+  }
+  else if (type == "HillsTile") {
+    tile = new HillsTile(location, depth_or_elevation, *climate, *geology);
   }
   else {
-    Require(false, "Unknown tile type \"" << type << "\".");
+    RequireUser(false, "Unknown tile type \"" << type << "\" at " << location);
   }
+
+  // The tile owns its geology now
+  geology.release();
+
+  return tile;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-Climate& WorldFactoryFromFile::get_Climate_from_parent()
+const Climate& WorldFactoryFromFile::parse_climate()
 ///////////////////////////////////////////////////////////////////////////////
 {
-  // m_curr_node is tile
-  xmlNodePtr parent = m_curr_node;
-  m_curr_node = m_curr_node->xmlChildrenNode;
-  while (m_curr_node != nullptr) {
-    if (!xmlStrcmp(m_curr_node->name, (const xmlChar *)"Climate")) {
-      std::vector<int> temperature = get_data_per_season_from_parent<int>("temperature");
-      std::vector<float> precip = get_data_per_season_from_parent<float>("precip");
-      std::vector<Wind> wind = get_data_per_season_from_parent<Wind>("wind");
-      m_curr_node = parent;
-      return *new Climate(temperature, precip, wind);
-    }
-    m_curr_node = m_curr_node->next;
-  }
-  Require(false, "Could not find Climate in a tile.");
+  // Reader is on a Climate element
+  std::vector<int> temperature;
+  std::vector<float> precip;
+  std::vector<Wind> wind;
+
+  const int climate_depth = depth();
+  for (bool more = first_child(climate_depth); more; more = next_sibling(climate_depth)) {
+    if (at("temperature")) {
+      temperature = element_data_per_season<int>();
+    }
+    else if (at("precip") || at("rainfall")) {
+      precip = element_data_per_season<float>();
+    }
+    else if (at("wind")) {
+      wind = element_data_per_season<Wind>();
+    }
+    else if (at("Wind")) {
+      wind.assign(size<Season>(), parse_wind());
+    }
+  }
+
+  RequireUser(!temperature.empty(), "Climate is missing temperature");
+  RequireUser(!precip.empty(),      "Climate is missing precip");
+  RequireUser(!wind.empty(),        "Climate is missing wind");
+
+  return ClimateTable::intern(Climate(temperature, precip, wind));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-Geology& WorldFactoryFromFile::get_Geology_from_parent()
+Wind WorldFactoryFromFile::parse_wind()
 ///////////////////////////////////////////////////////////////////////////////
 {
-  // m_curr_node is tile
-  xmlNodePtr parent = m_curr_node;
-  m_curr_node = m_curr_node->xmlChildrenNode;
-
-  while (m_curr_node != nullptr) {
-    if (!xmlStrcmp(m_curr_node->name, (const xmlChar *)"Geology")) {
-      char *geotype = get_element("type");
-      Geology* rv;
-      if (!strcmp(geotype, "Inactive")) {
-        rv = new Inactive;
-      }
-      else if (!strcmp(geotype, "Subducting")) {
-        float plate_movement = get_data_from_parent<float>("plate_movement");
-        rv = new Subducting(plate_movement);
-      }
-      else if (!strcmp(geotype, "Transform")) {
-        float plate_movement = get_data_from_parent<float>("plate_movement");
-        rv = new Transform(plate_movement);
-      }
-      else {
-        Require(false, "Unknown geology type \"" << geotype << "\".");
-      }
+  // Reader is on a Wind element
+  Wind wind;
+  bool has_speed = false, has_direction = false;
 
-      m_curr_node = parent;
-      return *rv;
+  const int wind_depth = depth();
+  for (bool more = first_child(wind_depth); more; more = next_sibling(wind_depth)) {
+    if (at("speed")) {
+      wind.m_speed = element_data<unsigned>();
+      has_speed = true;
     }
-    m_curr_node = m_curr_node->next;
+    else if (at("direction")) {
+      wind.m_direction = element_data<Direction>();
+      has_direction = true;
+    }
+  }
+
+  RequireUser(has_speed && has_direction, "Wind needs speed and direction");
+
+  return wind;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Geology* WorldFactoryFromFile::parse_geology()
+///////////////////////////////////////////////////////////////////////////////
+{
+  // Reader is on a Geology element
+  std::string type;
+  float plate_movement = 0.0;
+
+  const int geology_depth = depth();
+  for (bool more = first_child(geology_depth); more; more = next_sibling(geology_depth)) {
+    if (at("type")) {
+      type = element_text();
+    }
+    else if (at("plate_movement")) {
+      plate_movement = element_data<float>();
+    }
+  }
+
+  if (type == "Inactive") {
+    return new Inactive;
+  }
+  else if (type == "Divergent") {
+    return new Divergent(plate_movement);
+  }
+  else if (type == "Subducting") {
+    return new Subducting(plate_movement);
+  }
+  else if (type == "Orogenic") {
+    return new Orogenic(plate_movement);
+  }
+  else if (type == "Transform") {
+    return new Transform(plate_movement);
+  }
+  else {
+    RequireUser(false, "Unknown geology type \"" << type << "\".");
+    return nullptr;
   }
-  RequireUser(false, "Could not find Geology.");
 }
 
 ///////////////////////////////////////////////////////////////////////////////
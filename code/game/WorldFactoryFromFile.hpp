@@ -4,14 +4,28 @@
 #include "World.hpp"
 
 #include <string>
+#include <vector>
 #include <memory>
+#include <sstream>
 
-#include <libxml/parser.h>
+#include <libxml/xmlreader.h>
 
 namespace baal {
 
 class Engine;
 
+/**
+ * Loads worlds from .baalmap files.
+ *
+ * The map is read with a streaming xmlTextReader: each tile is built and
+ * handed to the world as soon as its element has been read, so memory use
+ * does not grow with the size of the file beyond the world itself.
+ * map_width and map_height must therefore come before the first tile.
+ * Cities may appear anywhere; they are placed once all tiles exist.
+ *
+ * Per-season climate values are whitespace-separated lists with one entry
+ * per season. A single entry applies to every season.
+ */
 class WorldFactoryFromFile
 {
  public:
@@ -22,6 +36,7 @@ class WorldFactoryFromFile
  private:
   WorldFactoryFromFile(const char* mapfilename, Engine& engine)
     : m_mapfilename(mapfilename),
+      m_reader(nullptr),
       m_engine(engine)
   {}
 
@@ -29,39 +44,68 @@ class WorldFactoryFromFile
 
   std::shared_ptr<World> load();
 
-  char* get_element(const char *elemname);
+  // Child-element iteration. The reader must be on the parent element's
+  // start tag when first_child is called; afterwards it is left on each
+  // child in turn. Handlers may leave the reader on a child's start tag or
+  // on its end tag.
+  bool first_child(int parent_depth);
+
+  bool next_sibling(int parent_depth);
+
+  bool advance_to_child(int rc, int parent_depth);
+
+  int depth() const { return xmlTextReaderDepth(m_reader); }
+
+  bool at(const char* elemname) const;
+
+  // Text content of the current element
+  std::string element_text();
 
   template <typename T>
-  T get_data_from_parent(const char *elemname)
+  T element_data()
   {
-    char *s = get_element(elemname);
+    const std::string text = element_text();
+    std::istringstream in(text);
     T data;
-    std::istringstream(s) >> data;
+    in >> data;
+    RequireUser(!in.fail(),
+                "Bad value '" << text << "' for " << xmlTextReaderConstName(m_reader) <<
+                " in map file " << m_mapfilename);
     return data;
   }
 
   template <typename T>
-  std::vector<T> get_data_per_season_from_parent(const char* elemname)
+  std::vector<T> element_data_per_season()
   {
-    char *s = get_element(elemname);
-    std::vector<T> data(4);
-    Require(size<Season>() == 4, "Invalid assumption in this code");
-    std::istringstream(s) >> data[0];// >> " " >> data[1] >> " " >> data[2] >> " " >> data[3];
+    const unsigned num_seasons = size<Season>();
+    const std::string text = element_text();
+    std::istringstream in(text);
+    std::vector<T> data;
+    T item;
+    while (in >> item) {
+      data.push_back(item);
+    }
+    RequireUser(in.eof() && (data.size() == 1 || data.size() == num_seasons),
+                "Expected 1 or " << num_seasons << " values for " <<
+                xmlTextReaderConstName(m_reader) << " in map file " << m_mapfilename <<
+                ", got '" << text << "'");
+    data.resize(num_seasons, data.front());
     return data;
   }
 
-  WorldTile& parse_Tile(int row, int col);
+  WorldTile* parse_tile();
+
+  const Climate& parse_climate();
 
-  Climate& get_Climate_from_parent();
+  Geology* parse_geology();
 
-  Geology& get_Geology_from_parent();
+  Wind parse_wind();
 
   // Members
 
-  const char* m_mapfilename;
-  xmlDocPtr   m_mapfile;
-  xmlNodePtr  m_curr_node;
-  Engine&     m_engine;
+  const char*      m_mapfilename;
+  xmlTextReaderPtr m_reader;
+  Engine&          m_engine;
 };
 
 bool is_baal_map_file(const std::string& filename);
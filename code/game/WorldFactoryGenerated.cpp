@@ -1,14 +1,575 @@
 #include "WorldFactoryGenerated.hpp"
 #include "World.hpp"
+#include "BaalExceptions.hpp"
+#include "BaalMath.hpp"
+#include "Weather.hpp"
+#include "Geology.hpp"
+
+#include <cmath>
+#include <sstream>
+#include <algorithm>
 
 namespace baal {
 
+constexpr unsigned WorldFactoryGenerated::DEFAULT_WIDTH;
+constexpr unsigned WorldFactoryGenerated::DEFAULT_HEIGHT;
+constexpr unsigned WorldFactoryGenerated::MIN_PLATE_SIZE;
+constexpr unsigned WorldFactoryGenerated::LATITUDE_BANDS;
+constexpr unsigned WorldFactoryGenerated::MOISTURE_STEPS;
+
+namespace {
+
+// Independent random streams drawn from the world seed
+const std::uint32_t ELEVATION_STREAM = 1;
+const std::uint32_t MOISTURE_STREAM  = 2;
+const std::uint32_t PLATE_STREAM     = 3;
+
+const unsigned MAX_OCTAVES = 8;
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint32_t noise_seed(std::uint64_t seed, std::uint32_t stream)
+///////////////////////////////////////////////////////////////////////////////
+{
+  return static_cast<std::uint32_t>(seed ^ (seed >> 32)) * 0x9e3779b9u + stream * 0x85ebca6bu;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline float lattice_value(std::uint32_t seed, std::int32_t x, std::int32_t y)
+///////////////////////////////////////////////////////////////////////////////
+{
+  // Integer hash of a lattice point to [0, 1). Only plain 32-bit integer
+  // ops, so the loops that call this vectorize.
+  std::uint32_t h = seed ^ (static_cast<std::uint32_t>(x) * 0x27d4eb2du)
+                         ^ (static_cast<std::uint32_t>(y) * 0x165667b1u);
+  h ^= h >> 15;
+  h *= 0x2c1b3c6du;
+  h ^= h >> 12;
+  h *= 0x297a2d39u;
+  h ^= h >> 15;
+  return static_cast<float>(h >> 8) * (1.0f / 16777216.0f);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline float smooth(float t)
+///////////////////////////////////////////////////////////////////////////////
+{
+  return t * t * (3.0f - 2.0f * t);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void add_noise_octave(float* out,
+                      unsigned width,
+                      unsigned row,
+                      float frequency,
+                      float amplitude,
+                      std::uint32_t seed)
+///////////////////////////////////////////////////////////////////////////////
+{
+  // Bilinear, smoothstepped value noise. Everything that depends only on
+  // the row is hoisted out of the column loop.
+  const float fy = row * frequency;
+  const std::int32_t y0 = static_cast<std::int32_t>(fy);
+  const float ty = smooth(fy - y0);
+
+  for (unsigned col = 0; col < width; ++col) {
+    const float fx = col * frequency;
+    const std::int32_t x0 = static_cast<std::int32_t>(fx);
+    const float tx = smooth(fx - x0);
+
+    const float v00 = lattice_value(seed, x0,     y0);
+    const float v10 = lattice_value(seed, x0 + 1, y0);
+    const float v01 = lattice_value(seed, x0,     y0 + 1);
+    const float v11 = lattice_value(seed, x0 + 1, y0 + 1);
+
+    const float top    = v00 + (v10 - v00) * tx;
+    const float bottom = v01 + (v11 - v01) * tx;
+    out[col] += amplitude * (top + (bottom - top) * ty);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void fractal_noise_row(float* out,
+                       unsigned width,
+                       unsigned height,
+                       unsigned row,
+                       std::uint32_t seed)
+///////////////////////////////////////////////////////////////////////////////
+{
+  // A few large features across the world, with finer octaves added until
+  // they would be smaller than a tile. Result is in [0, 1).
+  float frequency = 4.0f / std::max(width, height);
+  float amplitude = 1.0f;
+  float total     = 0.0f;
+
+  std::fill(out, out + width, 0.0f);
+  for (unsigned octave = 0; octave < MAX_OCTAVES && (octave == 0 || frequency <= 0.5f); ++octave) {
+    add_noise_octave(out, width, row, frequency, amplitude, seed + octave * 0x68e31da4u);
+    total     += amplitude;
+    frequency *= 2.0f;
+    amplitude *= 0.5f;
+  }
+
+  const float normalize = 1.0f / total;
+  for (unsigned col = 0; col < width; ++col) {
+    out[col] *= normalize;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float clamp_unit(float value)
+///////////////////////////////////////////////////////////////////////////////
+{
+  return value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+}
+
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 std::shared_ptr<World> WorldFactoryGenerated::create(Engine& engine)
 ///////////////////////////////////////////////////////////////////////////////
 {
-  // TODO
-  return std::shared_ptr<World>(new World(1, 1, engine));
+  return create(DEFAULT_WIDTH, DEFAULT_HEIGHT, World::DEFAULT_SEED, engine);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::shared_ptr<World> WorldFactoryGenerated::create(const std::string& world_config,
+                                                     Engine& engine)
+///////////////////////////////////////////////////////////////////////////////
+{
+  unsigned width = DEFAULT_WIDTH, height = DEFAULT_HEIGHT;
+  std::uint64_t seed = World::DEFAULT_SEED;
+
+  RequireUser(!world_config.empty() && world_config[0] == 'g',
+              "Generated world config must start with 'g', got: " << world_config);
+
+  std::istringstream in(world_config.substr(1));
+  if (in.peek() != std::istringstream::traits_type::eof() && in.peek() != ':') {
+    char x = '\0';
+    in >> width >> x >> height;
+    RequireUser(!in.fail() && x == 'x' && width > 0 && height > 0,
+                "Bad generated world size in '" << world_config << "', expect g<width>x<height>");
+    RequireUser(width <= World::MAX_DIMENSION && height <= World::MAX_DIMENSION,
+                "Generated world size in '" << world_config << "' too big, max is " << World::MAX_DIMENSION);
+  }
+  if (in.peek() == ':') {
+    in.get();
+    in >> seed;
+    RequireUser(!in.fail(), "Bad generated world seed in '" << world_config << "'");
+  }
+  RequireUser(in.peek() == std::istringstream::traits_type::eof(),
+              "Unexpected trailing characters in '" << world_config << "'");
+
+  return create(width, height, seed, engine);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::shared_ptr<World> WorldFactoryGenerated::create(unsigned width,
+                                                     unsigned height,
+                                                     std::uint64_t seed,
+                                                     Engine& engine)
+///////////////////////////////////////////////////////////////////////////////
+{
+  RequireUser(width > 0 && height > 0, "Generated world must have positive size");
+  RequireUser(width <= World::MAX_DIMENSION && height <= World::MAX_DIMENSION,
+              "Generated world " << width << "x" << height << " too big, max is " << World::MAX_DIMENSION);
+
+  WorldFactoryGenerated factory(width, height, seed);
+
+  std::shared_ptr<World> world(new World(width, height, engine));
+  world->set_seed(seed);
+  ThreadPool& pool = *world->m_thread_pool;
+
+  factory.generate_plates();
+  factory.share_geologies(*world);
+
+  // Each row's fields depend only on the plates and on the row itself
+  pool.parallel_for(0, height, [&factory](unsigned row_begin, unsigned row_end) {
+    for (unsigned row = row_begin; row < row_end; ++row) {
+      factory.compute_moisture_row(row);
+      factory.compute_elevation_row(row);
+    }
+  });
+
+  // Tiles go straight into the world, slots and all. Each range of rows
+  // interns its climates through a cache of its own, so the climate table
+  // is only locked once per distinct climate in the range.
+  World& target = *world;
+  pool.parallel_for(0, height, [&factory, &target](unsigned row_begin, unsigned row_end) {
+    climate_cache_type climates;
+    for (unsigned row = row_begin; row < row_end; ++row) {
+      factory.build_tile_row(row, target, climates);
+    }
+  });
+  world->index_tiles();
+
+  factory.place_capital(*world);
+
+  return world;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+WorldFactoryGenerated::WorldFactoryGenerated(unsigned width, unsigned height, std::uint64_t seed)
+///////////////////////////////////////////////////////////////////////////////
+  : m_width(width),
+    m_height(height),
+    m_seed(seed),
+    m_plate_size(std::max(MIN_PLATE_SIZE,
+                          static_cast<unsigned>(std::sqrt(float(width) * height / TARGET_NUM_PLATES)))),
+    m_plate_rows((height + m_plate_size - 1) / m_plate_size),
+    m_plate_cols((width  + m_plate_size - 1) / m_plate_size),
+    m_plates(),
+    m_plate(width * height),
+    m_other_plate(width * height),
+    m_boundary_dist(width * height),
+    m_elevation(width * height),
+    m_moisture(width * height),
+    m_inactive(nullptr),
+    m_boundary_geology()
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+void WorldFactoryGenerated::generate_plates()
+///////////////////////////////////////////////////////////////////////////////
+{
+  // One plate per grid cell, its site jittered within the cell
+  const float two_pi = 2 * std::acos(-1.0f);
+
+  m_plates.resize(m_plate_rows * m_plate_cols);
+  for (unsigned i = 0; i < m_plates.size(); ++i) {
+    const unsigned cell_row = i / m_plate_cols;
+    const unsigned cell_col = i % m_plate_cols;
+    const float angle = two_pi * counter_rand(m_seed, PLATE_STREAM, 5 * i + 2);
+    const float speed = (0.1f + 0.9f * counter_rand(m_seed, PLATE_STREAM, 5 * i + 3)) * MAX_PLATE_SPEED;
+
+    Plate& plate = m_plates[i];
+    plate.m_row         = (cell_row + counter_rand(m_seed, PLATE_STREAM, 5 * i))     * m_plate_size;
+    plate.m_col         = (cell_col + counter_rand(m_seed, PLATE_STREAM, 5 * i + 1)) * m_plate_size;
+    plate.m_vel_row     = speed * std::sin(angle);
+    plate.m_vel_col     = speed * std::cos(angle);
+    plate.m_continental = counter_rand(m_seed, PLATE_STREAM, 5 * i + 4) < 0.45;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void WorldFactoryGenerated::share_geologies(World& world)
+///////////////////////////////////////////////////////////////////////////////
+{
+  m_inactive = &world.share_geology(new Inactive);
+
+  // A tile's two nearest plates are both from the 3x3 cells around it (see
+  // compute_plate_row), so boundaries only lie between plates whose cells
+  // are at most two apart
+  const unsigned num_plates = m_plates.size();
+  m_boundary_geology.assign(num_plates * num_plates, nullptr);
+  for (unsigned plate = 0; plate < num_plates; ++plate) {
+    const unsigned cell_row = plate / m_plate_cols;
+    const unsigned cell_col = plate % m_plate_cols;
+    for (unsigned r = cell_row - std::min(cell_row, 2u); r < std::min(cell_row + 3, m_plate_rows); ++r) {
+      for (unsigned c = cell_col - std::min(cell_col, 2u); c < std::min(cell_col + 3, m_plate_cols); ++c) {
+        const unsigned other = r * m_plate_cols + c;
+        if (other != plate) {
+          m_boundary_geology[plate * num_plates + other] =
+            &world.share_geology(create_boundary_geology(plate, other));
+        }
+      }
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Geology* WorldFactoryGenerated::create_boundary_geology(unsigned plate, unsigned other) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  const float conv  = convergence(plate, other);
+  const float speed = relative_speed(plate, other);
+  if (std::fabs(conv) < 0.4f * speed) {
+    return new Transform(speed);
+  }
+  else if (conv > 0) {
+    if (m_plates[plate].m_continental && m_plates[other].m_continental) {
+      return new Orogenic(conv);
+    }
+    else {
+      return new Subducting(conv);
+    }
+  }
+  else {
+    return new Divergent(-conv);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float WorldFactoryGenerated::convergence(unsigned plate_a, unsigned plate_b) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  const Plate& a = m_plates[plate_a];
+  const Plate& b = m_plates[plate_b];
+
+  // Relative velocity of a toward b, projected on the line between sites
+  const float d_row = b.m_row - a.m_row;
+  const float d_col = b.m_col - a.m_col;
+  const float dist  = std::sqrt(d_row * d_row + d_col * d_col);
+  if (dist == 0.0f) {
+    return 0.0f;
+  }
+  return ((a.m_vel_row - b.m_vel_row) * d_row + (a.m_vel_col - b.m_vel_col) * d_col) / dist;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float WorldFactoryGenerated::relative_speed(unsigned plate_a, unsigned plate_b) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  const Plate& a = m_plates[plate_a];
+  const Plate& b = m_plates[plate_b];
+  const float v_row = a.m_vel_row - b.m_vel_row;
+  const float v_col = a.m_vel_col - b.m_vel_col;
+  return std::sqrt(v_row * v_row + v_col * v_col);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float WorldFactoryGenerated::latitude(unsigned row) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  const float half = m_height / 2.0f;
+  return std::fabs(row + 0.5f - half) / half;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void WorldFactoryGenerated::compute_plate_row(unsigned row, const float* noise)
+///////////////////////////////////////////////////////////////////////////////
+{
+  // A jittered site is always within its own cell, so the nearest two
+  // sites are (almost always) among the surrounding 3x3 cells
+  const unsigned cell_row  = row / m_plate_size;
+  const unsigned row_begin = cell_row > 0 ? cell_row - 1 : 0;
+  const unsigned row_end   = std::min(cell_row + 2, m_plate_rows);
+  const float    warp_size = m_plate_size / 2.0f;
+
+  for (unsigned col = 0; col < m_width; ++col) {
+    const unsigned cell_col  = col / m_plate_size;
+    const unsigned col_begin = cell_col > 0 ? cell_col - 1 : 0;
+    const unsigned col_end   = std::min(cell_col + 2, m_plate_cols);
+
+    // Warp the tile's position by the elevation noise so that boundaries
+    // wander instead of following straight lines
+    const float warp     = (noise[col] - 0.5f) * warp_size;
+    const float tile_row = row + 0.5f + warp;
+    const float tile_col = col + 0.5f - warp;
+
+    unsigned best = 0, second = 0;
+    float best_d2 = MAX_FLOAT, second_d2 = MAX_FLOAT;
+    for (unsigned r = row_begin; r < row_end; ++r) {
+      for (unsigned c = col_begin; c < col_end; ++c) {
+        const unsigned i = r * m_plate_cols + c;
+        const float d_row = m_plates[i].m_row - tile_row;
+        const float d_col = m_plates[i].m_col - tile_col;
+        const float d2 = d_row * d_row + d_col * d_col;
+        if (d2 < best_d2) {
+          second = best; second_d2 = best_d2;
+          best   = i;    best_d2   = d2;
+        }
+        else if (d2 < second_d2) {
+          second = i; second_d2 = d2;
+        }
+      }
+    }
+
+    const unsigned idx = row * m_width + col;
+    m_plate[idx] = best;
+    if (second_d2 == MAX_FLOAT) {
+      // Only one plate in the whole world
+      m_other_plate[idx]   = best;
+      m_boundary_dist[idx] = MAX_FLOAT;
+    }
+    else {
+      // Exact distance to the bisector of the two sites
+      const float d_row = m_plates[second].m_row - m_plates[best].m_row;
+      const float d_col = m_plates[second].m_col - m_plates[best].m_col;
+      const float site_dist = std::sqrt(d_row * d_row + d_col * d_col);
+      m_other_plate[idx]   = second;
+      m_boundary_dist[idx] = (second_d2 - best_d2) / (2 * site_dist);
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void WorldFactoryGenerated::compute_elevation_row(unsigned row)
+///////////////////////////////////////////////////////////////////////////////
+{
+  float* elevation = &m_elevation[row * m_width];
+  fractal_noise_row(elevation, m_width, m_height, row, noise_seed(m_seed, ELEVATION_STREAM));
+  compute_plate_row(row, elevation);
+
+  // Ridges and rifts reach a few tiles into each plate
+  const float ridge_width = std::max(1.5f, m_plate_size / 8.0f);
+
+  for (unsigned col = 0; col < m_width; ++col) {
+    const unsigned idx = row * m_width + col;
+    const unsigned plate = m_plate[idx];
+    const float crust = m_plates[plate].m_continental ? 0.57f : 0.4f;
+
+    float boundary = 0.0f;
+    if (m_other_plate[idx] != plate) {
+      const float conv = convergence(plate, m_other_plate[idx]) / MAX_PLATE_SPEED; // -2..2
+      const float falloff = std::exp(-m_boundary_dist[idx] / ridge_width);
+      boundary = (conv > 0 ? 0.25f : 0.06f) * conv * falloff;
+    }
+
+    elevation[col] = clamp_unit(crust + 0.7f * (elevation[col] - 0.5f) + boundary);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void WorldFactoryGenerated::compute_moisture_row(unsigned row)
+///////////////////////////////////////////////////////////////////////////////
+{
+  float* moisture = &m_moisture[row * m_width];
+  fractal_noise_row(moisture, m_width, m_height, row, noise_seed(m_seed, MOISTURE_STREAM));
+
+  // Wet at the equator and in the mid-latitudes, dry in the subtropics
+  // and at the poles
+  const float pi = std::acos(-1.0f);
+  const float band = 0.5f + 0.5f * std::cos(latitude(row) * 3 * pi);
+
+  for (unsigned col = 0; col < m_width; ++col) {
+    moisture[col] = clamp_unit(0.7f * moisture[col] + 0.3f * band);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void WorldFactoryGenerated::build_tile_row(unsigned row,
+                                           World& world,
+                                           climate_cache_type& climates) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  static const float season_factor[] = {-1.0f, 0.0f, 1.0f, 0.0f}; // by Season
+  static_assert(sizeof(season_factor) / sizeof(float) == 4, "One factor per season");
+
+  // Climate follows latitude by band, see LATITUDE_BANDS
+  const unsigned lat_band = static_cast<unsigned>(std::lround(latitude(row) * LATITUDE_BANDS));
+  const float lat = float(lat_band) / LATITUDE_BANDS;
+  const float hemisphere = (row + 0.5f < m_height / 2.0f) ? 1.0f : -1.0f; // north is up
+
+  // Prevailing winds by latitude band: trades, westerlies, polar easterlies
+  Direction wind_direction;
+  if (lat < 1.0f / 3) {
+    wind_direction = hemisphere > 0 ? NE : SE;
+  }
+  else if (lat < 2.0f / 3) {
+    wind_direction = hemisphere > 0 ? SW : NW;
+  }
+  else {
+    wind_direction = hemisphere > 0 ? NE : SE;
+  }
+
+  const std::uint64_t num_height_steps = static_cast<std::uint64_t>(MAX_ELEVATION / HEIGHT_STEP) + 2;
+  const std::uint64_t row_key = (std::uint64_t(lat_band) * 2 + (hemisphere > 0)) * num_height_steps;
+
+  for (unsigned col = 0; col < m_width; ++col) {
+    const unsigned idx = row * m_width + col;
+    const Location location(row, col);
+    const float elevation = m_elevation[idx];
+    const float moisture  = m_moisture[idx];
+    const bool is_ocean   = elevation < SEA_LEVEL;
+
+    // Climate, from inputs rounded to HEIGHT_STEP and MOISTURE_STEPS. Step
+    // zero of height is the ocean.
+    const float height_ft = is_ocean ? 0.0f : (elevation - SEA_LEVEL) / (1 - SEA_LEVEL) * MAX_ELEVATION;
+    const unsigned height_step   = is_ocean ? 0 : static_cast<unsigned>(std::lround(height_ft / HEIGHT_STEP)) + 1;
+    const unsigned moisture_step = static_cast<unsigned>(std::lround(moisture * MOISTURE_STEPS));
+    const float climate_height_ft = is_ocean ? 0.0f : (height_step - 1) * HEIGHT_STEP;
+    const float mean_temp = 85.0f - 80.0f * std::pow(lat, 1.5f) - 3.5f * climate_height_ft / 1000;
+
+    const std::uint64_t key = (row_key + height_step) * (MOISTURE_STEPS + 1) + moisture_step;
+    auto found = climates.find(key);
+    if (found == climates.end()) {
+      const float amplitude = (4.0f + 36.0f * lat) * (is_ocean ? 0.5f : 1.0f);
+      const float mean_precip = 1.0f + 24.0f * moisture_step / MOISTURE_STEPS;
+
+      Climate::Temperatures temperature;
+      Climate::Precips      precip;
+      Climate::Winds        wind;
+      for (Season season : iterate<Season>()) {
+        const float factor = hemisphere * season_factor[season]; // +1 in local summer
+        temperature[season] = static_cast<int>(std::lround(mean_temp + amplitude * factor));
+        precip[season]      = mean_precip * (1.0f + 0.15f * factor);
+        wind[season]        = Wind(static_cast<unsigned>(8 + 12 * lat + (factor < 0 ? 5 : 0)),
+                                   wind_direction);
+      }
+      found = climates.emplace(key, &ClimateTable::intern(temperature, precip, wind)).first;
+    }
+    const Climate& climate = *found->second;
+
+    // Geology
+    Geology* geology = m_inactive;
+    const unsigned plate = m_plate[idx], other = m_other_plate[idx];
+    if (plate != other && m_boundary_dist[idx] < BOUNDARY_WIDTH) {
+      geology = m_boundary_geology[plate * m_plates.size() + other];
+      Require(geology != nullptr, "No geology between plates " << plate << " and " << other);
+    }
+
+    // Tile type
+    const SlotPlacement placement(world.m_columns, idx);
+    WorldTile* tile = nullptr;
+    if (is_ocean) {
+      const unsigned depth = static_cast<unsigned>((SEA_LEVEL - elevation) / SEA_LEVEL * MAX_DEPTH);
+      tile = new OceanTile(location, depth, climate, *geology, placement);
+    }
+    else {
+      const unsigned height = static_cast<unsigned>(height_ft);
+      if (elevation >= MOUNTAIN_LEVEL) {
+        tile = new MountainTile(location, height, climate, *geology, placement);
+      }
+      else if (mean_temp < 28) {
+        tile = new TundraTile(location, height, climate, *geology, placement);
+      }
+      else if (elevation >= HILLS_LEVEL) {
+        tile = new HillsTile(location, height, climate, *geology, placement);
+      }
+      else if (moisture < 0.3f) {
+        tile = new DesertTile(location, height, climate, *geology, placement);
+      }
+      else if (moisture > 0.62f) {
+        tile = new LushTile(location, height, climate, *geology, placement);
+      }
+      else {
+        tile = new PlainsTile(location, height, climate, *geology, placement);
+      }
+    }
+
+    world.m_tiles[idx] = tile;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void WorldFactoryGenerated::place_capital(World& world) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  // Found the capital on the food-yielding tile closest to the middle of
+  // the world, falling back on any tile that supports a city
+  const float mid_row = m_height / 2.0f, mid_col = m_width / 2.0f;
+
+  Location best;
+  float best_score = MAX_FLOAT;
+  for (unsigned row = 0; row < m_height; ++row) {
+    for (unsigned col = 0; col < m_width; ++col) {
+      const WorldTile& tile = world.get_tile(Location(row, col));
+      if (!tile.supports_city()) {
+        continue;
+      }
+      const bool food = tile.type() == PLAINS || tile.type() == LUSH;
+      const float d_row = row - mid_row, d_col = col - mid_col;
+      const float score = d_row * d_row + d_col * d_col + (food ? 0.0f : float(m_width) * m_width + float(m_height) * m_height);
+      if (score < best_score) {
+        best_score = score;
+        best = Location(row, col);
+      }
+    }
+  }
+
+  if (best_score < MAX_FLOAT) {
+    world.place_city(best, "Capital");
+  }
 }
 
 }
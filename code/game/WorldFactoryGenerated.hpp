@@ -2,16 +2,135 @@
 #define WorldFactoryGenerated_hpp
 
 #include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
 
 namespace baal {
 
 class World;
+class WorldTile;
 class Engine;
+class Climate;
+class Geology;
 
+/**
+ * Procedurally generates worlds of any size from a seed.
+ *
+ * Plates are laid out on a jittered grid, each with a random velocity and
+ * either continental or oceanic crust. Elevation is plate crust plus
+ * fractal value noise, raised along convergent boundaries and lowered
+ * along divergent ones. Tile types follow from elevation, temperature and
+ * moisture; climate follows from latitude, elevation and moisture; tiles
+ * next to a plate boundary get the matching Geology.
+ *
+ * Every per-tile field is a pure function of (seed, location), computed a
+ * row at a time by tight loops spread over the world's thread pool, so the
+ * result is the same for any number of threads.
+ *
+ * Tiles are built straight into the world's columns. Climate inputs are
+ * quantized so that a band of rows has only a few distinct climates, each
+ * interned once, and tiles on the same boundary between two plates share
+ * one Geology, as do all tiles away from boundaries.
+ */
 class WorldFactoryGenerated
 {
  public:
+  // Default-sized world from the default seed
   static std::shared_ptr<World> create(Engine& engine);
+
+  /**
+   * Parse a world config of the form g[<width>x<height>][:<seed>],
+   * e.g. "g", "g512x256" or "g512x256:7".
+   */
+  static std::shared_ptr<World> create(const std::string& world_config, Engine& engine);
+
+  static std::shared_ptr<World> create(unsigned width,
+                                       unsigned height,
+                                       std::uint64_t seed,
+                                       Engine& engine);
+
+  static constexpr unsigned DEFAULT_WIDTH  = 24;
+  static constexpr unsigned DEFAULT_HEIGHT = 16;
+
+ private:
+  struct Plate
+  {
+    float m_row;       // site location, in tiles
+    float m_col;
+    float m_vel_row;   // cm/year
+    float m_vel_col;
+    bool  m_continental;
+  };
+
+  WorldFactoryGenerated(unsigned width, unsigned height, std::uint64_t seed);
+
+  void generate_plates();
+
+  // Kernels, each fills one row of the per-tile fields
+  void compute_plate_row(unsigned row, const float* noise);
+
+  void compute_elevation_row(unsigned row); // includes the plate row
+
+  void compute_moisture_row(unsigned row);
+
+  // Positive if plates a and b are moving toward each other, in cm/year
+  float convergence(unsigned plate_a, unsigned plate_b) const;
+
+  float relative_speed(unsigned plate_a, unsigned plate_b) const;
+
+  // Interned climates by quantized inputs, see climate_key
+  typedef std::unordered_map<std::uint64_t, const Climate*> climate_cache_type;
+
+  // The geologies tiles share, owned by world
+  void share_geologies(World& world);
+
+  // Caller owns the returned geology
+  Geology* create_boundary_geology(unsigned plate, unsigned other) const;
+
+  // Builds the row's tiles straight into world's tiles and columns
+  void build_tile_row(unsigned row, World& world, climate_cache_type& climates) const;
+
+  void place_capital(World& world) const;
+
+  float latitude(unsigned row) const; // 0 at equator, 1 at poles
+
+  // Members
+
+  unsigned      m_width;
+  unsigned      m_height;
+  std::uint64_t m_seed;
+  unsigned      m_plate_size; // tiles per plate cell, each way
+  unsigned      m_plate_rows;
+  unsigned      m_plate_cols;
+  std::vector<Plate> m_plates;
+
+  // Per-tile fields, row-major
+  std::vector<unsigned> m_plate;          // nearest plate
+  std::vector<unsigned> m_other_plate;    // second-nearest plate
+  std::vector<float>    m_boundary_dist;  // tiles to the plate boundary
+  std::vector<float>    m_elevation;      // 0..1, sea level at SEA_LEVEL
+  std::vector<float>    m_moisture;       // 0..1
+
+  // Shared geologies, owned by the world
+  Geology*              m_inactive;
+  std::vector<Geology*> m_boundary_geology; // by plate * num plates + other plate
+
+  static constexpr float SEA_LEVEL         = 0.5;
+  static constexpr float HILLS_LEVEL       = 0.72;
+  static constexpr float MOUNTAIN_LEVEL    = 0.82;
+  static constexpr float MAX_DEPTH         = 20000; // feet
+  static constexpr float MAX_ELEVATION     = 20000; // feet
+  static constexpr float MAX_PLATE_SPEED   = 10;    // cm/year
+  static constexpr float BOUNDARY_WIDTH    = 1.0;   // tiles
+  static constexpr unsigned TARGET_NUM_PLATES = 16;
+  static constexpr unsigned MIN_PLATE_SIZE    = 8;
+
+  // Climate inputs are rounded to these steps
+  static constexpr unsigned LATITUDE_BANDS = 90;    // pole to equator
+  static constexpr float    HEIGHT_STEP    = 250;   // feet
+  static constexpr unsigned MOISTURE_STEPS = 50;
 };
 
 }
@@ -6,6 +6,9 @@
 #include "Weather.hpp"
 #include "Engine.hpp"
 #include "PlayerAI.hpp"
+#include "Snapshot.hpp"
+
+#include <memory>
 
 namespace baal {
 
@@ -36,36 +39,54 @@ xmlNodePtr Yield::to_xml()
 }
 /*****************************************************************************/
 
+namespace {
+
+static_assert(SpellIdLAST <= 32, "Casts are tracked in a 32-bit mask per tile");
+
 ///////////////////////////////////////////////////////////////////////////////
-WorldTile::WorldTile(Location location, Yield yield, Climate& climate, Geology& geology)
+std::uint32_t spell_bit(SpellId spell)
+///////////////////////////////////////////////////////////////////////////////
+{
+  return std::uint32_t(1) << spell;
+}
+
+}
+
 ///////////////////////////////////////////////////////////////////////////////
-  : m_location(location),
+WorldTile::WorldTile(TileType type, Location location, Yield yield, const Climate& climate, Geology& geology,
+                     const SlotPlacement& placement)
+///////////////////////////////////////////////////////////////////////////////
+  : m_type(type),
+    m_location(location),
     m_base_yield(yield),
     m_climate(climate),
     m_geology(geology),
-    m_atmosphere(climate),
+    m_slot(placement),
+    m_atmosphere(climate, m_slot),
     m_worked(false),
-    m_casted_spells()
+    m_yield_cache(yield),
+    m_yield_cache_version(m_slot.yield_version() - 1)
 {}
 
 ///////////////////////////////////////////////////////////////////////////////
 WorldTile::~WorldTile()
 ///////////////////////////////////////////////////////////////////////////////
 {
-  delete &m_climate;
-  delete &m_geology;
+  if (!m_geology.shared()) {
+    delete &m_geology;
+  }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void WorldTile::cycle_turn(const std::vector<std::shared_ptr<const Anomaly>>& anomalies,
+void WorldTile::cycle_turn(const AnomalyField& anomalies,
                            const Location& location,
                            Season season)
 ///////////////////////////////////////////////////////////////////////////////
 {
-  m_geology.cycle_turn();
+  // Geology is caught up lazily, see Geology
   m_atmosphere.cycle_turn(anomalies, location, season);
   m_worked = false;
-  m_casted_spells.clear();
+  // Casts are forgotten by the World, for the whole map at once
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -77,18 +98,18 @@ void WorldTile::work()
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void WorldTile::cast(const std::string& spell)
+void WorldTile::cast(SpellId spell)
 ///////////////////////////////////////////////////////////////////////////////
 {
-  Require(!contains(m_casted_spells, spell), "Duplicate: " << spell);
-  m_casted_spells.push_back(spell);
+  Require(!already_casted(spell), "Duplicate: " << SpellFactory::name_of(spell));
+  m_slot.casted() |= spell_bit(spell);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-bool WorldTile::already_casted(const std::string& spell) const
+bool WorldTile::already_casted(SpellId spell) const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  return contains(m_casted_spells, spell);
+  return (m_slot.casted() & spell_bit(spell)) != 0;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -109,12 +130,80 @@ xmlNodePtr WorldTile::to_xml()
   return WorldTile_node;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void WorldTile::save(SnapshotWriter& out, std::uint32_t geology_index) const
+///////////////////////////////////////////////////////////////////////////////
+{
+  // Everything needed to construct the tile comes first
+  out.write(m_type);
+  out.write(m_location);
+  out.write(m_type == OCEAN ? depth() : elevation());
+  m_climate.save(out);
+  out.write(geology_index);
+
+  m_atmosphere.save(out);
+  out.write(m_worked);
+  if (m_type == OCEAN) {
+    out.write(static_cast<const OceanTile&>(*this).surface_temp());
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+WorldTile* WorldTile::load(SnapshotReader& in, const std::vector<Geology*>& geologies)
+///////////////////////////////////////////////////////////////////////////////
+{
+  const TileType type       = in.read_enum<TileType>();
+  const Location location   = in.read_location();
+  const unsigned depth_elev = in.read<unsigned>();
+  const Climate& climate = Climate::load(in);
+  const std::uint32_t geology_index = in.read<std::uint32_t>();
+  RequireUser(geology_index < geologies.size(),
+              "Corrupt snapshot, unknown geology " << geology_index << " at " << location);
+  Geology* geology = geologies[geology_index];
+
+  std::unique_ptr<WorldTile> tile;
+  switch (type) {
+  case OCEAN:
+    tile.reset(new OceanTile(location, depth_elev, climate, *geology));
+    break;
+  case MOUNTAIN:
+    tile.reset(new MountainTile(location, depth_elev, climate, *geology));
+    break;
+  case DESERT:
+    tile.reset(new DesertTile(location, depth_elev, climate, *geology));
+    break;
+  case TUNDRA:
+    tile.reset(new TundraTile(location, depth_elev, climate, *geology));
+    break;
+  case HILLS:
+    tile.reset(new HillsTile(location, depth_elev, climate, *geology));
+    break;
+  case PLAINS:
+    tile.reset(new PlainsTile(location, depth_elev, climate, *geology));
+    break;
+  case LUSH:
+    tile.reset(new LushTile(location, depth_elev, climate, *geology));
+    break;
+  default:
+    Require(false, "Unhandled tile type: " << type);
+  }
+
+  tile->m_atmosphere.load(in);
+  tile->m_worked = in.read<bool>();
+  if (type == OCEAN) {
+    static_cast<OceanTile&>(*tile).set_surface_temp(in.read<int>());
+  }
+
+  return tile.release();
+}
+
 /*****************************************************************************/
 
 ///////////////////////////////////////////////////////////////////////////////
-OceanTile::OceanTile(Location location, unsigned depth, Climate& climate, Geology& geology) :
+OceanTile::OceanTile(Location location, unsigned depth, const Climate& climate, Geology& geology,
+                     const SlotPlacement& placement) :
 ///////////////////////////////////////////////////////////////////////////////
-  WorldTile(location, Yield(OCEAN_FOOD, OCEAN_PROD), climate, geology),
+  WorldTile(OCEAN, location, Yield(OCEAN_FOOD, OCEAN_PROD), climate, geology, placement),
   m_depth(depth),
   m_surface_temp(0)
 {
@@ -126,7 +215,7 @@ OceanTile::OceanTile(Location location, unsigned depth, Climate& climate, Geolog
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void OceanTile::cycle_turn(const std::vector<std::shared_ptr<const Anomaly>>& anomalies,
+void OceanTile::cycle_turn(const AnomalyField& anomalies,
                            const Location& location,
                            Season season)
 ///////////////////////////////////////////////////////////////////////////////
@@ -142,15 +231,17 @@ void OceanTile::cycle_turn(const std::vector<std::shared_ptr<const Anomaly>>& an
 /*****************************************************************************/
 
 ///////////////////////////////////////////////////////////////////////////////
-LandTile::LandTile(Location location, unsigned elevation, Yield yield, Climate& climate, Geology& geology)
+LandTile::LandTile(TileType type, Location location, unsigned elevation, Yield yield, const Climate& climate, Geology& geology,
+                   const SlotPlacement& placement)
 ///////////////////////////////////////////////////////////////////////////////
-  : WorldTile(location, yield, climate, geology),
-    m_hp(1.0),
-    m_infra_level(0),
+  : WorldTile(type, location, yield, climate, geology, placement),
     m_elevation(elevation),
-    m_snowpack(0), // TODO: Should have prexisting snowpack
     m_city(nullptr)
-{}
+{
+  m_slot.hp()          = 1.0;
+  m_slot.infra_level() = 0;
+  m_slot.snowpack()    = 0; // TODO: Should have prexisting snowpack
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 LandTile::~LandTile()
@@ -167,21 +258,26 @@ void LandTile::damage(float dmg)
 {
   Require(dmg >= 0.0 && dmg <= 1.0, "Invalid value for damage: " << dmg);
 
-  m_hp *= (1.0 - dmg);
+  float& hp = m_slot.hp();
+  hp *= (1.0 - dmg);
+  m_slot.touch_yield();
 
-  Require(m_hp >= 0.0 && m_hp <= 1.0, "Invariant for hp failed: " << m_hp);
+  Require(hp >= 0.0 && hp <= 1.0, "Invariant for hp failed: " << hp);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void LandTile::cycle_turn(const std::vector<std::shared_ptr<const Anomaly>>& anomalies,
+void LandTile::cycle_turn(const AnomalyField& anomalies,
                           const Location& location,
                           Season season)
 ///////////////////////////////////////////////////////////////////////////////
 {
   WorldTile::cycle_turn(anomalies, location, season);
 
+  const float    prior_hp       = m_slot.hp();
+  const unsigned prior_snowpack = m_slot.snowpack();
+
   // Compute HP recovery
-  m_hp = land_tile_recovery_func(m_hp);
+  m_slot.hp() = land_tile_recovery_func(prior_hp);
 
   // Compute change in snowpack
   const float precip = atmosphere().precip();
@@ -193,33 +289,42 @@ void LandTile::cycle_turn(const std::vector<std::shared_ptr<const Anomaly>>& ano
   const float snowpack_melt_portion = portion_of_snowpack_that_melted(temp);
   const unsigned snowfall = (precip * 12) * snowfall_portion; // 12 inches of snow per liquid inch
 
-  m_snowpack = (snowfall + m_snowpack) * (1 - snowpack_melt_portion);
+  unsigned& snowpack = m_slot.snowpack();
+  snowpack = (snowfall + snowpack) * (1 - snowpack_melt_portion);
+
+  // Only invalidate cached yields if an input actually moved; settled tiles
+  // in calm weather keep their version so cities can skip re-ranking them.
+  if (m_slot.hp() != prior_hp || snowpack != prior_snowpack) {
+    m_slot.touch_yield();
+  }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void LandTile::build_infra()
 ///////////////////////////////////////////////////////////////////////////////
 {
-  Require(m_infra_level < LAND_TILE_MAX_INFRA, "Infra is maxed");
+  Require(m_slot.infra_level() < LAND_TILE_MAX_INFRA, "Infra is maxed");
   Require(city() == nullptr, "Cannot build infra if there is city here");
 
-  m_infra_level++;
+  m_slot.infra_level()++;
+  m_slot.touch_yield();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void LandTile::destroy_infra(unsigned num_destroyed)
 ///////////////////////////////////////////////////////////////////////////////
 {
-  Require(m_infra_level >= num_destroyed, "num_destroyed too high");
+  Require(m_slot.infra_level() >= num_destroyed, "num_destroyed too high");
 
-  m_infra_level -= num_destroyed;
+  m_slot.infra_level() -= num_destroyed;
+  m_slot.touch_yield();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-Yield LandTile::yield() const
+Yield LandTile::compute_yield() const
 ///////////////////////////////////////////////////////////////////////////////
 {
-  return compute_yield_func(m_base_yield, m_infra_level, m_hp);
+  return compute_yield_func(m_base_yield, m_slot.infra_level(), m_slot.hp());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -252,7 +357,7 @@ void MountainTile::place_city(City& city)
 /*****************************************************************************/
 
 ///////////////////////////////////////////////////////////////////////////////
-void TileWithSoil::cycle_turn(const std::vector<std::shared_ptr<const Anomaly>>& anomalies,
+void TileWithSoil::cycle_turn(const AnomalyField& anomalies,
                               const Location& location,
                               Season season)
 ///////////////////////////////////////////////////////////////////////////////
@@ -266,7 +371,7 @@ void TileWithSoil::cycle_turn(const std::vector<std::shared_ptr<const Anomaly>>&
   const int temp             = m_atmosphere.temperature();
   const float avg_precip     = m_climate.precip(season);
   const int avg_temp         = m_climate.temperature(season);
-  const float prior_moisture = m_soil_moisture;
+  const float prior_moisture = m_slot.soil_moisture();
 
   // Precip's effect on moisture
   const float precip_effect = precip_effect_on_moisture_func(avg_precip, precip);
@@ -278,15 +383,19 @@ void TileWithSoil::cycle_turn(const std::vector<std::shared_ptr<const Anomaly>>&
   // Compute overall seasonal forcing on soil moisture
   const float current_forcing = precip_effect * temp_effect;
 
-  m_soil_moisture = compute_moisture_func(prior_moisture, current_forcing);
+  const float moisture = compute_moisture_func(prior_moisture, current_forcing);
+  if (moisture != prior_moisture) {
+    m_slot.soil_moisture() = moisture;
+    m_slot.touch_yield();
+  }
 
-  Require(m_soil_moisture >= 0.0, "Moisture " << m_soil_moisture << " not valid");
+  Require(moisture >= 0.0, "Moisture " << moisture << " not valid");
 }
 
 /*****************************************************************************/
 
 ///////////////////////////////////////////////////////////////////////////////
-Yield FoodTile::yield() const
+Yield FoodTile::compute_yield() const
 ///////////////////////////////////////////////////////////////////////////////
 {
   Require (m_base_yield.m_food > 0, "Tiles with growth should yield food");
@@ -295,8 +404,8 @@ Yield FoodTile::yield() const
 
   // Food yielding tiles need to take soil moisture into account
   const float moisture_effect = moisture_yield_effect_func(m_soil_moisture);
-  const float snowpack_effect = snowpack_yield_effect_func(m_snowpack);
-  return LandTile::yield() * moisture_effect * snowpack_effect;
+  const float snowpack_effect = snowpack_yield_effect_func(m_slot.snowpack());
+  return LandTile::compute_yield() * moisture_effect * snowpack_effect;
 }
 
 }
@@ -4,6 +4,7 @@
 #include "Weather.hpp"
 #include "BaalCommon.hpp"
 #include "Time.hpp"
+#include "SpellFactory.hpp"
 
 #include <vector>
 #include <iosfwd>
@@ -12,11 +13,23 @@
 // We put all WorldTile classes in this header to avoid
 // generating a ton of header files.
 
+// One per concrete tile class. Lets World batch tiles by type without RTTI.
+SMART_ENUM(TileType,
+           OCEAN,
+           MOUNTAIN,
+           DESERT,
+           TUNDRA,
+           HILLS,
+           PLAINS,
+           LUSH);
+
 namespace baal {
 
 class City;
 class Geology;
 class Anomaly;
+class SnapshotWriter;
+class SnapshotReader;
 
 /**
  * A simple structure that specifies yields for tiles.
@@ -45,6 +58,10 @@ struct Yield
  *
  * Every tile has an atmosphere, climate, geology, and yield.
  *
+ * The fields that change every turn are not stored in the tile object
+ * itself but in the tile's TileSlot, which points into the World's
+ * TileColumns once the tile has been placed.
+ *
  * This class also serves as an aggregate of all the interfaces of the
  * Tile subclasses. Anything you can possibly do to any WorldTile must
  * be associated with some method in the WorldTile class. In some cases,
@@ -60,7 +77,8 @@ struct Yield
 class WorldTile
 {
  public:
-  WorldTile(Location location, Yield yield, Climate& climate, Geology& geology);
+  WorldTile(TileType type, Location location, Yield yield, const Climate& climate, Geology& geology,
+            const SlotPlacement& placement = SlotPlacement());
 
   virtual ~WorldTile();
 
@@ -71,9 +89,24 @@ class WorldTile
 
   // Basic tile interface
 
-  virtual Yield yield() const { return m_base_yield; }
+  /**
+   * Memoized; recomputed only after something bumped the slot's yield
+   * version (turn cycling, infra, damage, moisture, snowpack)
+   */
+  Yield yield() const
+  {
+    const unsigned version = m_slot.yield_version();
+    if (version != m_yield_cache_version) {
+      m_yield_cache         = compute_yield();
+      m_yield_cache_version = version;
+    }
+    return m_yield_cache;
+  }
 
-  virtual void cycle_turn(const std::vector<std::shared_ptr<const Anomaly>>& anomalies,
+  // Bumped whenever yield() may have changed
+  unsigned yield_version() const { return m_slot.yield_version(); }
+
+  virtual void cycle_turn(const AnomalyField& anomalies,
                           const Location& location,
                           Season season);
 
@@ -81,7 +114,7 @@ class WorldTile
 
   virtual bool supports_city() const { return false; }
 
-  void cast(const std::string& spell);
+  void cast(SpellId spell);
 
   // Land-related interface
 
@@ -127,10 +160,12 @@ class WorldTile
 
   // Getters
 
-  bool already_casted(const std::string& spell) const;
+  bool already_casted(SpellId spell) const;
 
   bool worked() const { return m_worked; }
 
+  TileType type() const { return m_type; }
+
   Location location() const { return m_location; }
 
   const Atmosphere& atmosphere() const { return m_atmosphere; }
@@ -143,17 +178,40 @@ class WorldTile
 
   xmlNodePtr to_xml();
 
+  // Fields kept in the slot are saved with the World's columns. Cities
+  // are saved by the World, and so are geologies, since tiles share them;
+  // a tile saves only the index of its geology in the World's table.
+  void save(SnapshotWriter& out, std::uint32_t geology_index) const;
+
+  // Caller owns the returned tile, but not its geology, which comes from
+  // geologies
+  static WorldTile* load(SnapshotReader& in, const std::vector<Geology*>& geologies);
+
  protected:
 
+  // Uncached yield; see yield()
+  virtual Yield compute_yield() const { return m_base_yield; }
+
   // Members
 
-  Location   m_location;
-  Yield      m_base_yield;
-  Climate&   m_climate;
-  Geology&   m_geology;
-  Atmosphere m_atmosphere;
-  bool       m_worked;
-  vecstr_t   m_casted_spells;
+  TileType       m_type;
+  Location       m_location;
+  Yield          m_base_yield;
+  const Climate& m_climate; // shared, see ClimateTable
+  Geology&       m_geology;
+  TileSlot       m_slot;
+  Atmosphere     m_atmosphere;
+  bool           m_worked;
+
+ private:
+
+  mutable Yield    m_yield_cache;
+  mutable unsigned m_yield_cache_version;
+
+  // Move this tile's hot fields into the world's columns
+  void bind(TileColumns& columns, unsigned index) { m_slot.bind(columns, index); }
+
+  friend class World;
 };
 
 /**
@@ -161,12 +219,13 @@ class WorldTile
  * depth (as in water-depth) and a water surface temperature
  * that is semi-independent of air temperature.
  */
-class OceanTile : public WorldTile
+class OceanTile final : public WorldTile
 {
  public:
-  OceanTile(Location location, unsigned depth, Climate& climate, Geology& geology);
+  OceanTile(Location location, unsigned depth, const Climate& climate, Geology& geology,
+            const SlotPlacement& placement = SlotPlacement());
 
-  virtual void cycle_turn(const std::vector<std::shared_ptr<const Anomaly>>& anomalies,
+  virtual void cycle_turn(const AnomalyField& anomalies,
                           const Location& location,
                           Season season);
 
@@ -197,19 +256,18 @@ class OceanTile : public WorldTile
 class LandTile: public WorldTile
 {
  public:
-  LandTile(Location location, unsigned elevation, Yield yield, Climate& climate, Geology& geology);
+  LandTile(TileType type, Location location, unsigned elevation, Yield yield, const Climate& climate, Geology& geology,
+           const SlotPlacement& placement = SlotPlacement());
 
   ~LandTile();
 
-  virtual Yield yield() const;
-
-  virtual void cycle_turn(const std::vector<std::shared_ptr<const Anomaly>>& anomalies,
+  virtual void cycle_turn(const AnomalyField& anomalies,
                           const Location& location,
                           Season season);
 
   virtual void damage(float dmg);
 
-  virtual unsigned infra_level() const { return m_infra_level; }
+  virtual unsigned infra_level() const { return m_slot.infra_level(); }
 
   virtual City* city() const { return m_city; }
 
@@ -217,9 +275,13 @@ class LandTile: public WorldTile
 
   virtual unsigned elevation() const { return m_elevation; }
 
-  virtual unsigned snowpack() const { return m_snowpack; }
+  virtual unsigned snowpack() const { return m_slot.snowpack(); }
 
-  virtual void set_snowpack(unsigned snowpack) { m_snowpack = snowpack; }
+  virtual void set_snowpack(unsigned snowpack)
+  {
+    m_slot.snowpack() = snowpack;
+    m_slot.touch_yield();
+  }
 
   void build_infra();
 
@@ -228,6 +290,8 @@ class LandTile: public WorldTile
 
  protected:
 
+  virtual Yield compute_yield() const;
+
   // Internal methods
 
   static float land_tile_recovery_func(float prior)
@@ -269,12 +333,10 @@ class LandTile: public WorldTile
     }
   }
 
-  // Members
+  // Members. Hp (0..1), infra level (0..MAX), and snowpack (in inches)
+  // are kept in m_slot.
 
-  float m_hp; // 0..1
-  unsigned m_infra_level; // 0..MAX
   unsigned m_elevation;
-  unsigned m_snowpack; // in inches
   City* m_city; // valid to have no (nullptr) city, so use ptr
 
   // Friends interface
@@ -295,11 +357,12 @@ class LandTile: public WorldTile
  * Represents mountain tiles. Mountains don't add any new concepts. Cities
  * can't be built on mountains.
  */
-class MountainTile : public LandTile
+class MountainTile final : public LandTile
 {
  public:
-  MountainTile(Location location, unsigned elevation, Climate& climate, Geology& geology)
-    : LandTile(location, elevation, Yield(MOUNTAIN_FOOD, MOUNTAIN_PROD), climate, geology)
+  MountainTile(Location location, unsigned elevation, const Climate& climate, Geology& geology,
+               const SlotPlacement& placement = SlotPlacement())
+    : LandTile(MOUNTAIN, location, elevation, Yield(MOUNTAIN_FOOD, MOUNTAIN_PROD), climate, geology, placement)
   {}
 
   virtual bool supports_city() const { return false; }
@@ -322,22 +385,26 @@ class MountainTile : public LandTile
 class TileWithSoil : public LandTile
 {
  public:
-  TileWithSoil(Location location, unsigned elevation, Yield yield, Climate& climate, Geology& geology)
-    : LandTile(location, elevation, yield, climate, geology),
-      m_soil_moisture(1.0)
-  {}
+  TileWithSoil(TileType type, Location location, unsigned elevation, Yield yield, const Climate& climate, Geology& geology,
+               const SlotPlacement& placement = SlotPlacement())
+    : LandTile(type, location, elevation, yield, climate, geology, placement)
+  {
+    m_slot.soil_moisture() = 1.0;
+  }
 
-  virtual float soil_moisture() const { return m_soil_moisture; }
+  virtual float soil_moisture() const { return m_slot.soil_moisture(); }
 
-  virtual void set_soil_moisture(float moisture) { m_soil_moisture = moisture; }
+  virtual void set_soil_moisture(float moisture)
+  {
+    m_slot.soil_moisture() = moisture;
+    m_slot.touch_yield();
+  }
 
-  virtual void cycle_turn(const std::vector<std::shared_ptr<const Anomaly>>& anomalies,
+  virtual void cycle_turn(const AnomalyField& anomalies,
                           const Location& location,
                           Season season);
 
  private:
-  float m_soil_moisture;
-
   static float precip_effect_on_moisture_func(float avg_precip, float precip)
   { return precip / avg_precip; }
 
@@ -351,11 +418,12 @@ class TileWithSoil : public LandTile
 /**
  * Represents desert tiles. Deserts add no concepts, so this class is simple.
  */
-class DesertTile : public TileWithSoil
+class DesertTile final : public TileWithSoil
 {
  public:
-  DesertTile(Location location, unsigned elevation, Climate& climate, Geology& geology)
-    : TileWithSoil(location, elevation, Yield(DESERT_FOOD, DESERT_PROD), climate, geology)
+  DesertTile(Location location, unsigned elevation, const Climate& climate, Geology& geology,
+             const SlotPlacement& placement = SlotPlacement())
+    : TileWithSoil(DESERT, location, elevation, Yield(DESERT_FOOD, DESERT_PROD), climate, geology, placement)
   {}
 
  private:
@@ -366,11 +434,12 @@ class DesertTile : public TileWithSoil
 /**
  * Represents tundra tiles. Tundra add no concepts, so this class is simple.
  */
-class TundraTile : public TileWithSoil
+class TundraTile final : public TileWithSoil
 {
  public:
-  TundraTile(Location location, unsigned elevation, Climate& climate, Geology& geology)
-    : TileWithSoil(location, elevation, Yield(TUNDRA_FOOD, TUNDRA_PROD), climate, geology)
+  TundraTile(Location location, unsigned elevation, const Climate& climate, Geology& geology,
+             const SlotPlacement& placement = SlotPlacement())
+    : TileWithSoil(TUNDRA, location, elevation, Yield(TUNDRA_FOOD, TUNDRA_PROD), climate, geology, placement)
   {}
 
  private:
@@ -381,11 +450,12 @@ class TundraTile : public TileWithSoil
 /**
  * Represents hill tiles. Hills add no concepts, so this class is simple.
  */
-class HillsTile : public TileWithSoil
+class HillsTile final : public TileWithSoil
 {
  public:
-  HillsTile(Location location, unsigned elevation, Climate& climate, Geology& geology)
-    : TileWithSoil(location, elevation, Yield(HILLS_FOOD, HILLS_PROD), climate, geology)
+  HillsTile(Location location, unsigned elevation, const Climate& climate, Geology& geology,
+            const SlotPlacement& placement = SlotPlacement())
+    : TileWithSoil(HILLS, location, elevation, Yield(HILLS_FOOD, HILLS_PROD), climate, geology, placement)
   {}
 
 private:
@@ -399,21 +469,27 @@ private:
 class FoodTile : public TileWithSoil
 {
  public:
-  FoodTile(Location location, unsigned elevation, Yield yield, Climate& climate, Geology& geology)
-    : TileWithSoil(location, elevation, yield, climate, geology),
+  FoodTile(TileType type, Location location, unsigned elevation, Yield yield, const Climate& climate, Geology& geology,
+           const SlotPlacement& placement = SlotPlacement())
+    : TileWithSoil(type, location, elevation, yield, climate, geology, placement),
       m_soil_moisture(1.0)
   {}
 
-  virtual Yield yield() const;
-
   float soil_moisture() const { return m_soil_moisture; }
 
-  void set_soil_moisture(float moisture) { m_soil_moisture = moisture; }
+  void set_soil_moisture(float moisture)
+  {
+    m_soil_moisture = moisture;
+    m_slot.touch_yield();
+  }
 
   static constexpr float FLOODING_THRESHOLD = 1.5;
   static constexpr float TOTALLY_FLOODED    = 2.75;
 
  protected:
+
+  virtual Yield compute_yield() const;
+
   float m_soil_moisture;
 
  private:
@@ -449,11 +525,12 @@ class FoodTile : public TileWithSoil
 /**
  * Represents plains tiles. Plains add no concepts, so this class is simple.
  */
-class PlainsTile : public FoodTile
+class PlainsTile final : public FoodTile
 {
  public:
-  PlainsTile(Location location, unsigned elevation, Climate& climate, Geology& geology)
-    : FoodTile(location, elevation, Yield(PLAINS_FOOD, PLAINS_PROD), climate, geology)
+  PlainsTile(Location location, unsigned elevation, const Climate& climate, Geology& geology,
+             const SlotPlacement& placement = SlotPlacement())
+    : FoodTile(PLAINS, location, elevation, Yield(PLAINS_FOOD, PLAINS_PROD), climate, geology, placement)
   {}
 
 private:
@@ -465,11 +542,12 @@ private:
  * Represents lush tiles. Lush add no concepts, so this class is simple. Lush
  * tiles are like plains tiles except they have higher food yields.
  */
-class LushTile : public FoodTile
+class LushTile final : public FoodTile
 {
  public:
-  LushTile(Location location, unsigned elevation, Climate& climate, Geology& geology)
-    : FoodTile(location, elevation, Yield(LUSH_FOOD, LUSH_PROD), climate, geology)
+  LushTile(Location location, unsigned elevation, const Climate& climate, Geology& geology,
+           const SlotPlacement& placement = SlotPlacement())
+    : FoodTile(LUSH, location, elevation, Yield(LUSH_FOOD, LUSH_PROD), climate, geology, placement)
   {}
 
 private:
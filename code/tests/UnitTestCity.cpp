@@ -2,6 +2,7 @@
 #include "Util.hpp"
 #include "World.hpp"
 #include "Engine.hpp"
+#include "Snapshot.hpp"
 
 #include <gtest/gtest.h>
 
@@ -9,6 +10,7 @@
 #include <sstream>
 #include <vector>
 #include <limits>
+#include <memory>
 
 using baal::details::CityImpl;
 using baal::Location;
@@ -37,7 +39,7 @@ TEST(City, CityBasics)
   EXPECT_EQ(1, city.rank());
   EXPECT_FALSE(city.famine());
   EXPECT_EQ(expected_defense, city.defense());
-  EXPECT_EQ(0.0, city.m_production);
+  EXPECT_EQ(0.0, city.m_slot.production());
 }
 
 TEST(City, CityAdvanced)
@@ -57,9 +59,9 @@ TEST(City, CityAdvanced)
   // Test producting some stuff
   CityImpl::Action build_defense(CityImpl::BUILD_DEFENSE);
   EXPECT_FALSE(city.produce_item(build_defense));
-  city.m_production = CityImpl::CITY_DEF_PROD_COST;
+  city.m_slot.production() = CityImpl::CITY_DEF_PROD_COST;
   EXPECT_TRUE(city.produce_item(build_defense));
-  EXPECT_EQ(0.0, city.m_production);
+  EXPECT_EQ(0.0, city.m_slot.production());
   EXPECT_EQ(starting_defense + 1, city.defense());
 
   // Test destroy defense
@@ -70,7 +72,7 @@ TEST(City, CityAdvanced)
   city.feed_people(city.get_required_food());
   EXPECT_GT(city.population(), starting_pop);
 
-  city.m_population = city.m_next_rank_pop;
+  city.m_slot.population() = city.m_slot.next_rank_pop();
   city.feed_people(city.get_required_food());
   EXPECT_EQ(2, city.rank());
 
@@ -87,10 +89,10 @@ TEST(City, CityAdvanced)
   baal::LandTile& infra_tile =
     dynamic_cast<baal::LandTile&>(engine->world().get_tile(infra_location));
   CityImpl::Action build_infra(CityImpl::BUILD_INFRA, &infra_tile);
-  city.m_production = CityImpl::INFRA_PROD_COST;
+  city.m_slot.production() = CityImpl::INFRA_PROD_COST;
   EXPECT_TRUE(city.produce_item(build_infra));
   EXPECT_EQ(1, infra_tile.infra_level());
-  EXPECT_EQ(0.0, city.m_production);
+  EXPECT_EQ(0.0, city.m_slot.production());
 }
 
 TEST(City, CityAI)
@@ -160,4 +162,147 @@ TEST(City, CityAI)
   EXPECT_NE(CityImpl::NO_ACTION, action.m_action_id);
 }
 
+TEST(City, TileRanking)
+{
+  // The ranking must follow yield changes and skip worked tiles
+  auto engine = baal::create_engine();
+  Location location(4, 2);
+  CityImpl city("testCity", location, *engine);
+
+  auto tiles_pair = city.examine_workable_tiles();
+  ASSERT_GT(tiles_pair.first.size(), 1u);
+  baal::WorldTile* worst = tiles_pair.first.back();
+  baal::LandTile& worst_land = dynamic_cast<baal::LandTile&>(*worst);
+  while (worst->yield().m_food <= tiles_pair.first.front()->yield().m_food) {
+    worst_land.build_infra();
+  }
+
+  tiles_pair = city.examine_workable_tiles();
+  EXPECT_EQ(worst, tiles_pair.first.front());
+
+  worst->work();
+  tiles_pair = city.examine_workable_tiles();
+  EXPECT_NE(worst, tiles_pair.first.front());
+  EXPECT_EQ(7u, tiles_pair.first.size() + tiles_pair.second.size());
+  for (const baal::WorldTile* tile : tiles_pair.first) {
+    EXPECT_NE(worst, tile);
+  }
+}
+
+TEST(City, SiteScoreCache)
+{
+  // The world's cached site scores must always match a fresh computation
+  auto engine = baal::create_engine();
+  baal::World& world = engine->world();
+
+  auto expect_all_match = [&]() {
+    for (unsigned row = 0; row < world.height(); ++row) {
+      for (unsigned col = 0; col < world.width(); ++col) {
+        Location location(row, col);
+        EXPECT_EQ(baal::details::compute_city_loc_heuristic(location, *engine),
+                  world.city_site_score(location)) << location;
+      }
+    }
+  };
+
+  expect_all_match();
+
+  // Change a yield
+  Location infra_loc(1, 1);
+  auto& land_tile = dynamic_cast<baal::LandTile&>(world.get_tile(infra_loc));
+  land_tile.build_infra();
+  expect_all_match();
+
+  // Place and remove a city
+  Location city_loc(2, 3);
+  world.place_city(city_loc, "testCity");
+  expect_all_match();
+  world.remove_city(*world.get_tile(city_loc).city());
+  expect_all_match();
+
+  world.cycle_turn();
+  expect_all_match();
+}
+
+TEST(City, FeedCities)
+{
+  // Feeding a batch of cities through the columns must match feeding each
+  // city on its own
+
+  auto engine = baal::create_engine();
+  const std::vector<float> food_ratios = {0.0, 0.25, 0.5, 0.99, 1.0, 1.5, 4.0, 10.0};
+  const unsigned num_cities = food_ratios.size();
+
+  baal::CityColumns columns(num_cities);
+  std::vector<std::unique_ptr<CityImpl> > cities;
+  for (unsigned i = 0; i < num_cities; ++i) {
+    cities.emplace_back(new CityImpl("testCity", Location(0, i), *engine));
+    CityImpl& city = *cities.back();
+
+    // Put some cities right below their next rank
+    city.m_slot.population() = (i % 2 == 0) ? city.m_slot.next_rank_pop() - 1 : 1500;
+    const float food = city.get_required_food() * food_ratios[i];
+
+    columns.copy_slot(i, city.m_slot.columns(), city.m_slot.index());
+    columns.m_food[i] = food;
+
+    city.feed_people(food);
+  }
+
+  baal::details::feed_cities(columns, 0, num_cities);
+
+  for (unsigned i = 0; i < num_cities; ++i) {
+    const CityImpl& city = *cities[i];
+    EXPECT_EQ(city.population(),           columns.m_population[i]) << i;
+    EXPECT_EQ(city.rank(),                 columns.m_rank[i]) << i;
+    EXPECT_EQ(city.m_slot.next_rank_pop(), columns.m_next_rank_pop[i]) << i;
+    EXPECT_EQ(city.famine(),               columns.m_famine[i] != 0) << i;
+  }
+}
+
+TEST(City, LoadRejectsCorruptCity)
+{
+  auto engine = baal::create_engine();
+  CityImpl city("testCity", Location(4, 2), *engine);
+
+  auto load = [&city](unsigned rank, unsigned population, unsigned next_rank_pop) {
+    std::stringstream stream;
+    baal::SnapshotWriter out(stream);
+    out.write(rank);
+    out.write(population);
+    out.write(next_rank_pop);
+    out.write(0.0f);
+    out.write(1u);
+    out.write(false);
+
+    baal::SnapshotReader in(stream);
+    city.load(in);
+  };
+
+  const unsigned pop = CityImpl::CITY_STARTING_POP;
+  const unsigned next_rank_pop = pop * CityImpl::CITY_RANK_UP_MULTIPLIER;
+  EXPECT_THROW(load(0, pop, pop), baal::UserError);
+  EXPECT_THROW(load(1, 0, next_rank_pop), baal::UserError);
+  EXPECT_THROW(load(1, pop, next_rank_pop * 2), baal::UserError);
+  EXPECT_THROW(load(1, next_rank_pop + 1, next_rank_pop), baal::UserError);
+  EXPECT_THROW(load(100, pop, next_rank_pop), baal::UserError);
+
+  load(2, next_rank_pop, next_rank_pop * CityImpl::CITY_RANK_UP_MULTIPLIER);
+  EXPECT_EQ(2, city.rank());
+  EXPECT_EQ(next_rank_pop, city.population());
+}
+
+TEST(City, KillKeepsRankAtLeastOne)
+{
+  auto engine = baal::create_engine();
+  CityImpl city("testCity", Location(4, 2), *engine);
+  ASSERT_EQ(1, city.rank());
+
+  // A rank 1 city that loses all but one citizen stays at rank 1 rather
+  // than wrapping its unsigned rank around
+  city.kill(city.population() - 1);
+  EXPECT_EQ(1, city.rank());
+  EXPECT_EQ(1u, city.population());
+}
+
 }
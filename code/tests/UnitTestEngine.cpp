@@ -1,4 +1,6 @@
 #include "Engine.hpp"
+#include "InterfaceFactory.hpp"
+#include "World.hpp"
 
 #include <gtest/gtest.h>
 
@@ -14,4 +16,14 @@ TEST(Engine, Basic)
   engine->play();
 }
 
+TEST(Engine, Headless)
+{
+  using namespace baal;
+
+  // Turns can be cycled without going through the interface
+  auto engine = create_engine(Configuration(InterfaceFactory::HEADLESS_INTERFACE));
+  EXPECT_EQ(IN_PROGRESS, engine->cycle_turn());
+  EXPECT_EQ(1u, engine->world().time().turn());
+}
+
 }
@@ -1,4 +1,5 @@
 #include "Geology.hpp"
+#include "BaalExceptions.hpp"
 
 #include <gtest/gtest.h>
 
@@ -26,21 +27,21 @@ TEST(Geology, Subducting)
   geology.cycle_turn();
   geology.cycle_turn();
 
-  float tension = geology.tension();
-  float magma   = geology.magma();
+  float tension = geology.stored_tension();
+  float magma   = geology.stored_magma();
 
   geology.cycle_turn();
   geology.cycle_turn();
 
-  EXPECT_LT(tension, geology.tension());
-  EXPECT_LT(magma  , geology.magma());
+  EXPECT_LT(tension, geology.stored_tension());
+  EXPECT_LT(magma  , geology.stored_magma());
 
   for (unsigned i = 0; i < 1000; ++i) {
     geology.cycle_turn();
   }
 
-  EXPECT_LT(geology.tension(), 1.0);
-  EXPECT_LT(geology.magma(),   1.0);
+  EXPECT_LT(geology.stored_tension(), 1.0);
+  EXPECT_LT(geology.stored_magma(),   1.0);
 }
 
 TEST(Geology, Transform)
@@ -54,14 +55,14 @@ TEST(Geology, Transform)
   EXPECT_GT(geology.tension_buildup(), 0.0);
   EXPECT_EQ(geology.magma_buildup(),   0.0);
 
-  float tension = geology.tension();
-  float magma   = geology.magma();
+  float tension = geology.stored_tension();
+  float magma   = geology.stored_magma();
 
   geology.cycle_turn();
   geology.cycle_turn();
 
-  EXPECT_LT(tension, geology.tension());
-  EXPECT_EQ(magma  , geology.magma());
+  EXPECT_LT(tension, geology.stored_tension());
+  EXPECT_EQ(magma  , geology.stored_magma());
 }
 
 TEST(Geology, Inactive)
@@ -73,15 +74,45 @@ TEST(Geology, Inactive)
   EXPECT_EQ(geology.tension_buildup(), 0.0);
   EXPECT_EQ(geology.magma_buildup(),   0.0);
 
-  float tension = geology.tension();
-  float magma   = geology.magma();
+  float tension = geology.stored_tension();
+  float magma   = geology.stored_magma();
 
   for (unsigned i = 0; i < 1000; ++i) {
     geology.cycle_turn();
   }
 
-  EXPECT_EQ(tension, geology.tension());
-  EXPECT_EQ(magma  , geology.magma());
+  EXPECT_EQ(tension, geology.stored_tension());
+  EXPECT_EQ(magma  , geology.stored_magma());
+}
+
+TEST(Geology, CatchUp)
+{
+  using namespace baal;
+
+  Subducting stepped(3.0);
+  Subducting lazy(3.0);
+
+  float tension = 0.0, magma = 0.0;
+  for (unsigned i = 0; i < 50; ++i) {
+    stepped.cycle_turn();
+    tension += (1 - tension) * stepped.tension_buildup();
+    magma   += (1 - magma)   * stepped.magma_buildup();
+  }
+
+  // Reading ahead does not change stored state
+  EXPECT_NEAR(tension, lazy.tension(50), 1e-5);
+  EXPECT_NEAR(magma,   lazy.magma(50),   1e-5);
+  EXPECT_EQ(0u,  lazy.turn());
+  EXPECT_EQ(0.0, lazy.stored_tension());
+
+  lazy.catch_up(20);
+  lazy.catch_up(50);
+  EXPECT_EQ(50u, lazy.turn());
+  EXPECT_NEAR(stepped.stored_tension(), lazy.stored_tension(), 1e-5);
+  EXPECT_NEAR(stepped.stored_magma(),   lazy.stored_magma(),   1e-5);
+  EXPECT_EQ(lazy.stored_tension(), lazy.tension(50));
+
+  EXPECT_THROW(lazy.catch_up(49), ProgramError);
 }
 
 }
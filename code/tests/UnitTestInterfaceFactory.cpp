@@ -1,6 +1,7 @@
 #include "InterfaceFactory.hpp"
 #include "InterfaceText.hpp"
 #include "InterfaceGraphical.hpp"
+#include "InterfaceHeadless.hpp"
 #include "Engine.hpp"
 #include "Configuration.hpp"
 
@@ -56,6 +57,15 @@ TEST(InterfaceFactory, basic)
     InterfaceText* expected_interface = dynamic_cast<InterfaceText*>(interface);
     EXPECT_NE(nullptr, expected_interface);
   }
+
+  {
+    Configuration config(InterfaceFactory::HEADLESS_INTERFACE);
+    auto engine = create_engine(config);
+
+    Interface* interface = &engine->interface();
+    InterfaceHeadless* expected_interface = dynamic_cast<InterfaceHeadless*>(interface);
+    EXPECT_NE(nullptr, expected_interface);
+  }
 }
 
 }
@@ -2,6 +2,9 @@
 #include "Engine.hpp"
 #include "Spell.hpp"
 #include "SpellFactory.hpp"
+#include "World.hpp"
+#include "City.hpp"
+#include "InterfaceFactory.hpp"
 
 #include <gtest/gtest.h>
 
@@ -27,5 +30,48 @@ TEST(PlayerAI, PlayerAIBasics)
   EXPECT_EQ(ai.tech_level(), 2u);
 }
 
+TEST(PlayerAI, DeterministicAcrossThreads)
+{
+  using namespace baal;
+
+  // Crowd a map with cities so that many of them share tiles, then check
+  // that the city turns come out the same for any number of threads
+  const Configuration config(InterfaceFactory::HEADLESS_INTERFACE, "g48x32:11");
+  auto engine1 = create_engine(config);
+  auto engine4 = create_engine(config);
+  engine1->world().set_num_threads(1);
+  engine4->world().set_num_threads(4);
+
+  for (auto engine : {engine1, engine4}) {
+    World& world = engine->world();
+    for (unsigned row = 0; row < world.height(); row += 3) {
+      for (unsigned col = (row / 3) % 2; col < world.width(); col += 3) {
+        const Location location(row, col);
+        if (world.get_tile(location).supports_city() &&
+            world.get_tile(location).city() == nullptr) {
+          world.place_city(location);
+        }
+      }
+    }
+  }
+  ASSERT_GT(engine1->world().cities().size(), 20u);
+
+  for (int turn = 0; turn < 30; ++turn) {
+    engine1->ai_player().cycle_turn();
+    engine4->ai_player().cycle_turn();
+    engine1->world().cycle_turn();
+    engine4->world().cycle_turn();
+
+    const std::vector<City*>& cities1 = engine1->world().cities();
+    const std::vector<City*>& cities4 = engine4->world().cities();
+    ASSERT_EQ(cities1.size(), cities4.size());
+    for (unsigned i = 0; i < cities1.size(); ++i) {
+      EXPECT_EQ(cities1[i]->location(),   cities4[i]->location());
+      EXPECT_EQ(cities1[i]->population(), cities4[i]->population());
+      EXPECT_EQ(cities1[i]->defense(),    cities4[i]->defense());
+    }
+    EXPECT_EQ(engine1->ai_player().population(), engine4->ai_player().population());
+  }
+}
 
 }
@@ -0,0 +1,181 @@
+#include "Engine.hpp"
+#include "InterfaceFactory.hpp"
+#include "World.hpp"
+#include "Player.hpp"
+#include "PlayerAI.hpp"
+#include "Geology.hpp"
+#include "BaalExceptions.hpp"
+#include "Snapshot.hpp"
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <set>
+
+namespace {
+
+void expect_same_world(const baal::World& world1, const baal::World& world2)
+{
+  using namespace baal;
+
+  ASSERT_EQ(world1.width(),  world2.width());
+  ASSERT_EQ(world1.height(), world2.height());
+  EXPECT_EQ(world1.seed(), world2.seed());
+  EXPECT_EQ(world1.time().turn(), world2.time().turn());
+  const unsigned turn = world1.time().turn();
+  EXPECT_EQ(world1.anomalies().size(), world2.anomalies().size());
+
+  for (unsigned row = 0; row < world1.height(); ++row) {
+    for (unsigned col = 0; col < world1.width(); ++col) {
+      Location loc(row, col);
+      const WorldTile& tile1 = world1.get_tile(loc);
+      const WorldTile& tile2 = world2.get_tile(loc);
+      ASSERT_EQ(tile1.type(), tile2.type());
+      EXPECT_EQ(tile1.atmosphere().temperature(), tile2.atmosphere().temperature());
+      EXPECT_EQ(tile1.atmosphere().precip(),      tile2.atmosphere().precip());
+      EXPECT_EQ(tile1.atmosphere().pressure(),    tile2.atmosphere().pressure());
+      EXPECT_EQ(tile1.atmosphere().dewpoint(),    tile2.atmosphere().dewpoint());
+      EXPECT_EQ(tile1.geology().tension(turn),    tile2.geology().tension(turn));
+      EXPECT_EQ(tile1.infra_level(),              tile2.infra_level());
+      EXPECT_EQ(tile1.yield().m_food,             tile2.yield().m_food);
+      EXPECT_EQ(tile1.yield().m_prod,             tile2.yield().m_prod);
+      EXPECT_EQ(tile1.city() == nullptr,          tile2.city() == nullptr);
+    }
+  }
+
+  ASSERT_EQ(world1.cities().size(), world2.cities().size());
+  for (unsigned i = 0; i < world1.cities().size(); ++i) {
+    const City& city1 = *world1.cities()[i];
+    const City& city2 = *world2.cities()[i];
+    EXPECT_EQ(city1.name(),       city2.name());
+    EXPECT_EQ(city1.location(),   city2.location());
+    EXPECT_EQ(city1.population(), city2.population());
+    EXPECT_EQ(city1.rank(),       city2.rank());
+    EXPECT_EQ(city1.defense(),    city2.defense());
+  }
+}
+
+TEST(Snapshot, RoundTrip)
+{
+  using namespace baal;
+
+  const std::string filename = "UnitTestSnapshot.save";
+  const Configuration config(InterfaceFactory::HEADLESS_INTERFACE);
+
+  auto engine = create_engine(config);
+  engine->world().set_seed(7);
+  for (int turn = 0; turn < 25; ++turn) {
+    engine->cycle_turn();
+  }
+  engine->save(filename);
+
+  auto loaded = create_engine(config);
+  loaded->load(filename);
+  std::remove(filename.c_str());
+
+  expect_same_world(engine->world(), loaded->world());
+  EXPECT_EQ(engine->player().name(),     loaded->player().name());
+  EXPECT_EQ(engine->player().mana(),     loaded->player().mana());
+  EXPECT_EQ(engine->player().exp(),      loaded->player().exp());
+  EXPECT_EQ(engine->player().level(),    loaded->player().level());
+  EXPECT_EQ(engine->ai_player().tech_level(),  loaded->ai_player().tech_level());
+  EXPECT_EQ(engine->ai_player().tech_points(), loaded->ai_player().tech_points());
+  EXPECT_EQ(engine->ai_player().population(),  loaded->ai_player().population());
+
+  // A restored game carries on exactly as the original would have
+  for (int turn = 0; turn < 10; ++turn) {
+    engine->cycle_turn();
+    loaded->cycle_turn();
+  }
+  expect_same_world(engine->world(), loaded->world());
+}
+
+TEST(Snapshot, SharedGeologies)
+{
+  using namespace baal;
+
+  const std::string filename = "UnitTestSnapshot.geology";
+  const Configuration config(InterfaceFactory::HEADLESS_INTERFACE, "g64x48:7");
+
+  auto engine = create_engine(config);
+  engine->save(filename);
+
+  auto loaded = create_engine(config);
+  loaded->load(filename);
+  std::remove(filename.c_str());
+
+  // Tiles that shared a geology before saving share one after loading, and
+  // tiles that did not, do not
+  const World& world1 = engine->world();
+  const World& world2 = loaded->world();
+  std::map<const Geology*, const Geology*> to_loaded;
+  std::set<const Geology*> loaded_geologies;
+  for (unsigned row = 0; row < world1.height(); ++row) {
+    for (unsigned col = 0; col < world1.width(); ++col) {
+      const Location location(row, col);
+      const Geology& geology1 = world1.get_tile(location).geology();
+      const Geology& geology2 = world2.get_tile(location).geology();
+      EXPECT_TRUE(geology2.shared());
+      EXPECT_EQ(geology1.tension_buildup(), geology2.tension_buildup());
+      EXPECT_EQ(geology1.magma_buildup(),   geology2.magma_buildup());
+
+      auto mapped = to_loaded.emplace(&geology1, &geology2);
+      EXPECT_EQ(&geology2, mapped.first->second);
+      loaded_geologies.insert(&geology2);
+    }
+  }
+  EXPECT_LT(to_loaded.size(), std::size_t(world1.width() * world1.height()));
+  EXPECT_EQ(to_loaded.size(), loaded_geologies.size());
+}
+
+TEST(Snapshot, BadFile)
+{
+  using namespace baal;
+
+  const std::string filename = "UnitTestSnapshot.bad";
+  {
+    std::ofstream out(filename.c_str());
+    out << "<baal_root>not a snapshot</baal_root>";
+  }
+
+  auto engine = create_engine(Configuration(InterfaceFactory::HEADLESS_INTERFACE));
+  const unsigned width = engine->world().width();
+
+  EXPECT_THROW(engine->load(filename), UserError);
+  EXPECT_THROW(engine->load("no_such_file.save"), UserError);
+  std::remove(filename.c_str());
+
+  // A failed load leaves the current game alone
+  EXPECT_EQ(width, engine->world().width());
+}
+
+TEST(Snapshot, BadWorldSize)
+{
+  using namespace baal;
+
+  auto engine = create_engine(Configuration(InterfaceFactory::HEADLESS_INTERFACE));
+  const unsigned width = engine->world().width();
+
+  // Sizes that overflow, that are too big, and that the file cannot hold
+  const std::pair<unsigned, unsigned> sizes[] = {
+    {65536, 65536}, {1u << 20, 1}, {2000, 2000}
+  };
+  const std::string filename = "UnitTestSnapshot.big";
+  for (const auto& size : sizes) {
+    {
+      std::ofstream file(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+      SnapshotWriter out(file);
+      write_snapshot_header(out);
+      out.write(size.first);
+      out.write(size.second);
+      out.write<std::uint64_t>(0);
+    }
+    EXPECT_THROW(engine->load(filename), UserError) << size.first << "x" << size.second;
+  }
+  std::remove(filename.c_str());
+
+  EXPECT_EQ(width, engine->world().width());
+}
+
+}
@@ -2,6 +2,8 @@
 #include "Engine.hpp"
 #include "Spell.hpp"
 #include "SpellFactory.hpp"
+#include "World.hpp"
+#include "City.hpp"
 
 #include <gtest/gtest.h>
 
@@ -18,5 +20,90 @@ TEST(Spell, SpellBasics)
   // auto hot = baal::SpellFactory::create_spell(baal::Hot::NAME, *engine, 5);
 }
 
+TEST(Spell, CheckApply)
+{
+  using namespace baal;
+
+  auto engine = create_engine();
+  World& world = engine->world();
+
+  // Find an ocean tile and a food tile without a city
+  Location ocean, food;
+  bool found_ocean = false, found_food = false;
+  for (unsigned row = 0; row < world.height(); ++row) {
+    for (unsigned col = 0; col < world.width(); ++col) {
+      const Location location(row, col);
+      WorldTile& tile = world.get_tile(location);
+      if (!found_ocean && tile.type() == OCEAN) {
+        ocean = location;
+        found_ocean = true;
+      }
+      if (!found_food && dynamic_cast<FoodTile*>(&tile) != nullptr && tile.city() == nullptr) {
+        food = location;
+        found_food = true;
+      }
+    }
+  }
+  ASSERT_TRUE(found_ocean && found_food);
+
+  auto fire_at_sea = SpellFactory::create_spell(FIRE_SPELL, *engine, 1, ocean);
+  const SpellCheck failed = fire_at_sea->check_apply();
+  EXPECT_FALSE(failed.ok());
+  EXPECT_EQ(SpellCheck::NEEDS_PLANT_GROWTH, failed.code());
+  EXPECT_NE(std::string::npos, failed.message().find(fire_at_sea->name()));
+  EXPECT_THROW(fire_at_sea->verify_apply(), UserError);
+
+  auto fire = SpellFactory::create_spell(FIRE_SPELL, *engine, 1, food);
+  EXPECT_TRUE(fire->check_apply().ok());
+  fire->verify_apply();
+
+  world.get_tile(food).cast(FIRE_SPELL);
+  EXPECT_EQ(SpellCheck::ALREADY_CAST, fire->check_apply().code());
+  EXPECT_THROW(fire->verify_apply(), UserError);
+}
+
+
+TEST(Spell, KillCity)
+{
+  using namespace baal;
+
+  auto engine = create_engine();
+  World& world = engine->world();
+  ASSERT_EQ(1u, world.cities().size());
+  City& doomed = *world.cities()[0];
+  const Location doomed_location = doomed.location();
+
+  // Found a second city away from the first; it takes the last city slot
+  Location other;
+  bool found = false;
+  for (unsigned row = 0; row < world.height() && !found; ++row) {
+    for (unsigned col = 0; col < world.width() && !found; ++col) {
+      other = Location(row, col);
+      const WorldTile& tile = world.get_tile(other);
+      found = tile.supports_city() && tile.city() == nullptr && tile.infra_level() == 0 &&
+        doomed_location.distance(other) > 2;
+    }
+  }
+  ASSERT_TRUE(found);
+  world.place_city(other, "survivor");
+  City& survivor = *world.get_tile(other).city();
+  const unsigned survivor_pop = survivor.population();
+
+  // Leave the first city barely alive, then finish it off. At this level
+  // the spell kills only about a third of the city directly.
+  doomed.kill(doomed.population() - City::MIN_CITY_SIZE);
+  auto hot = SpellFactory::create_spell(HOT_SPELL, *engine, 12, doomed_location);
+  const unsigned exp = hot->apply();
+
+  // Exp counts every citizen of a wiped-out city, survivors of the spell's
+  // kill percentage included, plus the 1000 city-destroy bonus
+  EXPECT_EQ(City::MIN_CITY_SIZE + 1000, exp);
+
+  ASSERT_EQ(1u, world.cities().size());
+  EXPECT_EQ(&survivor, world.cities()[0]);
+  EXPECT_TRUE(world.get_tile(doomed_location).city() == nullptr);
+  EXPECT_EQ(survivor_pop, survivor.population());
+}
+
 
 }
@@ -20,5 +20,32 @@ TEST(SpellFactory, Basic)
   EXPECT_THROW(baal::SpellFactory::create_spell("does not exist", *engine), baal::UserError);
 }
 
+TEST(SpellFactory, Ids)
+{
+  using namespace baal;
+
+  auto engine = create_engine();
+
+  // Every name maps to its id, and the spell made from an id agrees
+  for (SpellId id : iterate<SpellId>()) {
+    const std::string& name = SpellFactory::name_of(id);
+    EXPECT_EQ(id, SpellFactory::find_id(name));
+
+    auto spell = SpellFactory::create_spell(id, *engine);
+    EXPECT_EQ(id, spell->id());
+    EXPECT_EQ(name, spell->name());
+
+    // The prototype is the one the spell was made from
+    EXPECT_EQ(&SpellFactory::prototype(id).m_prereq, &spell->prereq());
+    EXPECT_EQ(id, SpellFactory::prototype(id).m_id);
+  }
+
+  for (const char* name : {"", "h", "quake", "hotx", "Hot", "does not exist"}) {
+    EXPECT_EQ(SpellIdLAST, SpellFactory::find_id(name)) << name;
+    EXPECT_FALSE(SpellFactory::is_in_all_names(name)) << name;
+  }
+  EXPECT_THROW(SpellFactory::id_of("quake"), UserError);
+}
+
 
 }
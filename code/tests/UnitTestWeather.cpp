@@ -1,6 +1,8 @@
 #include "Weather.hpp"
 #include "Engine.hpp"
 #include "World.hpp"
+#include "ThreadPool.hpp"
+#include "InterfaceFactory.hpp"
 
 #include <gtest/gtest.h>
 #include <sstream>
@@ -34,12 +36,15 @@ TEST(Weather, Anomaly)
   World& world = engine->world();
 
   Location loc(0,0);
-  std::shared_ptr<const Anomaly> anom;
-  while (anom == nullptr) {
-    anom = Anomaly::generate_anomaly(PRECIP_ANOMALY,
-                                     loc,
-                                     world);
-  }
+  std::vector<Anomaly> anomalies;
+  // Rolls in the lower half of anomaly_roll's range make dry anomalies
+  ASSERT_TRUE(Anomaly::generate_anomaly(PRECIP_ANOMALY,
+                                        loc,
+                                        world,
+                                        Anomaly::anomaly_roll(0.25),
+                                        anomalies));
+  ASSERT_EQ(1u, anomalies.size());
+  const Anomaly* anom = &anomalies[0];
 
   float precip_effect = anom->precip_effect(loc);
   EXPECT_LE(std::abs(anom->intensity()), Anomaly::MAX_INTENSITY);
@@ -64,12 +69,15 @@ TEST(Weather, weather)
   Climate climate(temps, precips, winds);
   Atmosphere atmosphere(climate);
 
-  std::vector<std::shared_ptr<const Anomaly> > anomalies;
+  std::vector<Anomaly> anomalies;
+  AnomalyField field(1, 1);
+  ThreadPool pool(1);
+  field.compute(anomalies, pool);
   Location loc(0, 0);
 
   for (int i = 0; i < 2; ++i) {
     for (Season s : iterate<Season>()) {
-      atmosphere.cycle_turn(anomalies, loc, s);
+      atmosphere.cycle_turn(field, loc, s);
 
       EXPECT_EQ(climate.temperature(s), temps[s]);
       EXPECT_EQ(climate.temperature(s), atmosphere.temperature());
@@ -80,19 +88,151 @@ TEST(Weather, weather)
     }
   }
 
-  std::shared_ptr<const Anomaly> anom;
-  while (anom == nullptr || anom->intensity() < 0) {
-    anom = Anomaly::generate_anomaly(TEMPERATURE_ANOMALY,
-                                     loc,
-                                     world);
-  }
-  anomalies.push_back(anom);
+  // Rolls in the upper half of anomaly_roll's range make warm anomalies
+  anomalies.clear();
+  ASSERT_TRUE(Anomaly::generate_anomaly(TEMPERATURE_ANOMALY,
+                                        loc,
+                                        world,
+                                        Anomaly::anomaly_roll(0.75),
+                                        anomalies));
+  ASSERT_GT(anomalies.back().intensity(), 0);
+  field.compute(anomalies, pool);
 
-  atmosphere.cycle_turn(anomalies, loc, WINTER);
+  atmosphere.cycle_turn(field, loc, WINTER);
 
   EXPECT_GT(atmosphere.temperature(), temps[WINTER]);
   EXPECT_EQ(atmosphere.precip(), precips[WINTER]);
   EXPECT_EQ(atmosphere.wind(), winds[WINTER]);
 }
 
+TEST(Weather, ClimateTable)
+{
+  using namespace baal;
+
+  const Climate::Temperatures temps {{60, 70, 80, 70}};
+  const Climate::Precips precips {{1, 2, 3, 4}};
+  const Climate::Winds winds {{Wind(10, NNW), Wind(10, NNW), Wind(10, NNW), Wind(5, N)}};
+
+  const Climate& climate = ClimateTable::intern(temps, precips, winds);
+  const std::size_t num_climates = ClimateTable::size();
+
+  // Equal climates share a record
+  EXPECT_EQ(&climate, &ClimateTable::intern(Climate(temps, precips, winds)));
+  EXPECT_EQ(&climate, &ClimateTable::get(climate.id()));
+  EXPECT_EQ(num_climates, ClimateTable::size());
+  EXPECT_EQ(climate.wind(FALL), Wind(5, N));
+
+  // Different climates do not
+  Climate::Precips wetter(precips);
+  wetter[SUMMER] += 1;
+  const Climate& wet_climate = ClimateTable::intern(temps, wetter, winds);
+  EXPECT_NE(&climate, &wet_climate);
+  EXPECT_NE(climate.id(), wet_climate.id());
+  EXPECT_EQ(num_climates + 1, ClimateTable::size());
+
+  // Engines share records too
+  auto engine1 = baal::create_engine();
+  auto engine2 = baal::create_engine();
+  const Location loc(0, 0);
+  EXPECT_EQ(&engine1->world().get_tile(loc).climate(),
+            &engine2->world().get_tile(loc).climate());
+}
+
+TEST(Weather, AnomalyField)
+{
+  using namespace baal;
+
+  // Big enough that anomalies reach beyond their epicenter
+  auto engine = create_engine(Configuration(InterfaceFactory::HEADLESS_INTERFACE, "g256x128:1"));
+  const World& world = engine->world();
+
+  // Overlapping anomalies of each category, some of them clipped by the
+  // edge of the map
+  const std::vector<Location> epicenters {
+    Location(0, 0), Location(2, 3), Location(60, 100), Location(61, 101),
+    Location(127, 255), Location(125, 2), Location(64, 128)
+  };
+  std::vector<Anomaly> anomalies;
+  for (unsigned i = 0; i < epicenters.size(); ++i) {
+    for (AnomalyCategory category : iterate<AnomalyCategory>()) {
+      const float unit_roll = float(i * size<AnomalyCategory>() + category) / (epicenters.size() * size<AnomalyCategory>());
+      ASSERT_TRUE(Anomaly::generate_anomaly(category,
+                                            epicenters[i],
+                                            world,
+                                            Anomaly::anomaly_roll(unit_roll),
+                                            anomalies));
+    }
+  }
+  ASSERT_GT(anomalies[0].radius(), 0u);
+
+  AnomalyField field(world.width(), world.height());
+  ThreadPool pool(3);
+  field.compute(anomalies, pool);
+
+  // The blurred field must match the sum of each anomaly's own falloff
+  for (unsigned row = 0; row < world.height(); ++row) {
+    for (unsigned col = 0; col < world.width(); ++col) {
+      const Location location(row, col);
+      for (AnomalyCategory category : iterate<AnomalyCategory>()) {
+        float expected = 0.0;
+        for (const Anomaly& anomaly : anomalies) {
+          if (anomaly.category() == category) {
+            expected += anomaly.intensity() * anomaly.falloff(location);
+          }
+        }
+        EXPECT_NEAR(expected, field.intensity(category, location), 1e-5) << location;
+      }
+    }
+  }
+
+  // Full effect at an isolated epicenter, none far away from every anomaly
+  const Anomaly& lone = anomalies[6 * size<AnomalyCategory>() + TEMPERATURE_ANOMALY];
+  EXPECT_EQ(lone.temp_effect(lone.location()), field.temp_effect(lone.location()));
+  EXPECT_EQ(1.0, field.precip_effect(Location(30, 200)));
+  EXPECT_EQ(0, field.pressure_effect(Location(30, 200)));
+}
+
+TEST(Weather, AnomalyRoll)
+{
+  using namespace baal;
+
+  auto engine = baal::create_engine();
+  const World& world = engine->world();
+  const Location loc(2, 3);
+  const int num_intensities = 2 * Anomaly::MAX_INTENSITY + 1;
+
+  // Intensity histogram over evenly spaced rolls
+  auto histogram = [&](unsigned num_rolls, bool anomaly_rolls) {
+    std::vector<unsigned> counts(num_intensities, 0);
+    std::vector<Anomaly> anomalies;
+    for (unsigned i = 0; i < num_rolls; ++i) {
+      const float unit_roll = (i + 0.5f) / num_rolls;
+      anomalies.clear();
+      Anomaly::generate_anomaly(PRECIP_ANOMALY,
+                                loc,
+                                world,
+                                anomaly_rolls ? Anomaly::anomaly_roll(unit_roll) : unit_roll,
+                                anomalies);
+      ++counts[anomalies.empty() ? Anomaly::MAX_INTENSITY : anomalies[0].intensity() + Anomaly::MAX_INTENSITY];
+    }
+    return counts;
+  };
+
+  const unsigned num_rolls = 1u << 22;
+  const std::vector<unsigned> all = histogram(num_rolls, false);
+  const unsigned num_anomalies = num_rolls - all[Anomaly::MAX_INTENSITY];
+  EXPECT_NEAR(Anomaly::ANOMALY_PROBABILITY, float(num_anomalies) / num_rolls, 1e-5);
+
+  // Rolls from anomaly_roll always produce an anomaly, with the same
+  // distribution of intensities as the anomalies from plain rolls
+  const unsigned num_anomaly_rolls = 1u << 16;
+  const std::vector<unsigned> conditional = histogram(num_anomaly_rolls, true);
+  EXPECT_EQ(0u, conditional[Anomaly::MAX_INTENSITY]);
+  for (int i = 0; i < num_intensities; ++i) {
+    if (i != int(Anomaly::MAX_INTENSITY)) {
+      EXPECT_NEAR(float(all[i]) / num_anomalies, float(conditional[i]) / num_anomaly_rolls, 0.01) << i;
+    }
+  }
+}
+
 }
@@ -1,6 +1,7 @@
 #include "Weather.hpp"
 #include "Engine.hpp"
 #include "World.hpp"
+#include "InterfaceFactory.hpp"
 
 #include <gtest/gtest.h>
 #include <sstream>
@@ -118,4 +119,308 @@ TEST(World, NearbyTileRange)
   }
 }
 
+TEST(World, TileType)
+{
+  using namespace baal;
+
+  auto engine = baal::create_engine();
+  World& world = engine->world();
+
+  for (unsigned row = 0; row < world.height(); ++row) {
+    for (unsigned col = 0; col < world.width(); ++col) {
+      const WorldTile& tile = world.get_tile(Location(row, col));
+      switch (tile.type()) {
+      case OCEAN:
+        EXPECT_TRUE(dynamic_cast<const OceanTile*>(&tile) != nullptr);
+        break;
+      case MOUNTAIN:
+        EXPECT_TRUE(dynamic_cast<const MountainTile*>(&tile) != nullptr);
+        break;
+      case DESERT:
+        EXPECT_TRUE(dynamic_cast<const DesertTile*>(&tile) != nullptr);
+        break;
+      case TUNDRA:
+        EXPECT_TRUE(dynamic_cast<const TundraTile*>(&tile) != nullptr);
+        break;
+      case HILLS:
+        EXPECT_TRUE(dynamic_cast<const HillsTile*>(&tile) != nullptr);
+        break;
+      case PLAINS:
+        EXPECT_TRUE(dynamic_cast<const PlainsTile*>(&tile) != nullptr);
+        break;
+      case LUSH:
+        EXPECT_TRUE(dynamic_cast<const LushTile*>(&tile) != nullptr);
+        break;
+      default:
+        FAIL() << "Bad tile type " << tile.type();
+      }
+    }
+  }
+}
+
+TEST(World, DeterministicAcrossThreads)
+{
+  using namespace baal;
+
+  auto engine1 = baal::create_engine();
+  auto engine4 = baal::create_engine();
+  World& world1 = engine1->world();
+  World& world4 = engine4->world();
+
+  world1.set_num_threads(1);
+  world4.set_num_threads(4);
+  world1.set_seed(42);
+  world4.set_seed(42);
+
+  for (int turn = 0; turn < 40; ++turn) {
+    world1.cycle_turn();
+    world4.cycle_turn();
+
+    ASSERT_EQ(world1.anomalies().size(), world4.anomalies().size());
+    for (unsigned row = 0; row < world1.height(); ++row) {
+      for (unsigned col = 0; col < world1.width(); ++col) {
+        Location loc(row, col);
+        const Atmosphere& atmos1 = world1.get_tile(loc).atmosphere();
+        const Atmosphere& atmos4 = world4.get_tile(loc).atmosphere();
+        EXPECT_EQ(atmos1.temperature(), atmos4.temperature());
+        EXPECT_EQ(atmos1.precip(),      atmos4.precip());
+        EXPECT_EQ(atmos1.pressure(),    atmos4.pressure());
+      }
+    }
+  }
+}
+
+TEST(World, ConfiguredNumThreads)
+{
+  using namespace baal;
+
+  auto engine = create_engine(Configuration(InterfaceFactory::HEADLESS_INTERFACE, "", "", "3"));
+  EXPECT_EQ(3u, engine->world().num_threads());
+
+  EXPECT_THROW(create_engine(Configuration(InterfaceFactory::HEADLESS_INTERFACE, "", "", "0")),
+               UserError);
+  EXPECT_THROW(create_engine(Configuration(InterfaceFactory::HEADLESS_INTERFACE, "", "", "3x")),
+               UserError);
+}
+
+TEST(World, CityIndex)
+{
+  using namespace baal;
+
+  auto engine = create_engine(Configuration(InterfaceFactory::HEADLESS_INTERFACE, "g40x20:5"));
+  World& world = engine->world();
+
+  // Add a city on every fifth land tile so that they span several cells
+  unsigned count = 0;
+  for (unsigned row = 0; row < world.height(); ++row) {
+    for (unsigned col = 0; col < world.width(); ++col) {
+      const Location location(row, col);
+      const WorldTile& tile = world.get_tile(location);
+      if (tile.supports_city() && tile.city() == nullptr && ++count % 5 == 0) {
+        world.place_city(location);
+      }
+    }
+  }
+  ASSERT_GT(world.cities().size(), 10u);
+
+  auto check_queries = [&world]() {
+    const CityIndex& index = world.city_index();
+    for (unsigned row = 0; row < world.height(); ++row) {
+      for (unsigned col = 0; col < world.width(); ++col) {
+        const Location location(row, col);
+        EXPECT_EQ(world.get_tile(location).city(), index.find(location));
+        for (unsigned distance = 0; distance < 4; ++distance) {
+          bool expected = false;
+          for (const City* city : world.cities()) {
+            expected = expected || location.distance(city->location()) <= distance;
+          }
+          EXPECT_EQ(expected, index.any_within(location, distance)) << location;
+        }
+      }
+    }
+  };
+
+  check_queries();
+
+  // Remove from the front, middle and back
+  world.remove_city(*world.cities().front());
+  world.remove_city(*world.cities()[world.cities().size() / 2]);
+  world.remove_city(*world.cities().back());
+  check_queries();
+}
+
+TEST(World, SleepingChunks)
+{
+  using namespace baal;
+
+  // Both worlds see the same turns; the reference simulates every chunk
+  // every turn, while the other lets quiet chunks sleep and is only looked
+  // at now and then
+  const Configuration config(InterfaceFactory::HEADLESS_INTERFACE, "g64x48:7");
+  auto reference_engine = create_engine(config);
+  auto sleepy_engine    = create_engine(config);
+  World& reference = reference_engine->world();
+  World& sleepy    = sleepy_engine->world();
+  reference.set_sleeping(false);
+
+  // Uneven stretches so that catching up crosses season boundaries
+  for (unsigned num_turns : {5u, 7u, 2u}) {
+    for (unsigned turn = 0; turn < num_turns; ++turn) {
+      reference.cycle_turn();
+      sleepy.cycle_turn();
+    }
+
+    unsigned num_asleep = 0;
+    for (unsigned row = 0; row < sleepy.height(); ++row) {
+      for (unsigned col = 0; col < sleepy.width(); ++col) {
+        const Location location(row, col);
+        EXPECT_FALSE(reference.is_asleep(location));
+        num_asleep += sleepy.is_asleep(location);
+      }
+    }
+    EXPECT_GT(num_asleep, 0u);
+
+    for (unsigned row = 0; row < sleepy.height(); ++row) {
+      for (unsigned col = 0; col < sleepy.width(); ++col) {
+        const Location location(row, col);
+        const WorldTile& reference_tile = reference.get_tile(location);
+        const WorldTile& sleepy_tile    = sleepy.get_tile(location);
+        EXPECT_FALSE(sleepy.is_asleep(location));
+
+        const Atmosphere& reference_atmos = reference_tile.atmosphere();
+        const Atmosphere& sleepy_atmos    = sleepy_tile.atmosphere();
+        EXPECT_EQ(reference_atmos.temperature(), sleepy_atmos.temperature());
+        EXPECT_EQ(reference_atmos.dewpoint(),    sleepy_atmos.dewpoint());
+        EXPECT_EQ(reference_atmos.wind(),        sleepy_atmos.wind());
+        EXPECT_EQ(reference_atmos.precip(),      sleepy_atmos.precip());
+        EXPECT_EQ(reference_atmos.pressure(),    sleepy_atmos.pressure());
+        EXPECT_EQ(reference_tile.yield().m_food, sleepy_tile.yield().m_food);
+        EXPECT_EQ(reference_tile.yield().m_prod, sleepy_tile.yield().m_prod);
+        if (reference_tile.type() == OCEAN) {
+          EXPECT_EQ(dynamic_cast<const OceanTile&>(reference_tile).surface_temp(),
+                    dynamic_cast<const OceanTile&>(sleepy_tile).surface_temp());
+        }
+        else {
+          EXPECT_EQ(reference_tile.snowpack(), sleepy_tile.snowpack());
+        }
+        if (dynamic_cast<const TileWithSoil*>(&reference_tile) != nullptr) {
+          EXPECT_EQ(reference_tile.soil_moisture(), sleepy_tile.soil_moisture());
+        }
+      }
+    }
+  }
+}
+
+TEST(World, YieldCache)
+{
+  using namespace baal;
+
+  auto engine = create_engine();
+  World& world = engine->world();
+
+  // Find a food tile without a city
+  LandTile* tile = nullptr;
+  for (unsigned row = 0; row < world.height() && tile == nullptr; ++row) {
+    for (unsigned col = 0; col < world.width() && tile == nullptr; ++col) {
+      WorldTile& candidate = world.get_tile(Location(row, col));
+      if (dynamic_cast<FoodTile*>(&candidate) != nullptr && candidate.city() == nullptr) {
+        tile = dynamic_cast<LandTile*>(&candidate);
+      }
+    }
+  }
+  ASSERT_TRUE(tile != nullptr);
+
+  // Every mutator has to be seen by the next yield()
+  float food = tile->yield().m_food;
+  EXPECT_EQ(food, tile->yield().m_food);
+
+  tile->build_infra();
+  EXPECT_LT(food, tile->yield().m_food);
+  food = tile->yield().m_food;
+
+  tile->damage(0.5);
+  EXPECT_GT(food, tile->yield().m_food);
+  food = tile->yield().m_food;
+
+  FoodTile* food_tile = dynamic_cast<FoodTile*>(tile);
+  food_tile->set_soil_moisture(food_tile->soil_moisture() / 2);
+  EXPECT_GT(food, tile->yield().m_food);
+  food = tile->yield().m_food;
+
+  tile->set_snowpack(50);
+  EXPECT_GT(food, tile->yield().m_food);
+  food = tile->yield().m_food;
+
+  // Damaged tiles recover over a turn
+  world.cycle_turn();
+  EXPECT_NE(food, tile->yield().m_food);
+}
+
+TEST(World, CalmTurnKeepsYieldVersion)
+{
+  using namespace baal;
+
+  auto engine = create_engine();
+  World& world = engine->world();
+
+  // Find a food tile warm enough in summer that no snow falls
+  FoodTile* tile = nullptr;
+  Location location;
+  for (unsigned row = 0; row < world.height() && tile == nullptr; ++row) {
+    for (unsigned col = 0; col < world.width() && tile == nullptr; ++col) {
+      location = Location(row, col);
+      WorldTile& candidate = world.get_tile(location);
+      if (candidate.climate().temperature(SUMMER) >= 60 &&
+          candidate.climate().precip(SUMMER) > 0.0) {
+        tile = dynamic_cast<FoodTile*>(&candidate);
+      }
+    }
+  }
+  ASSERT_TRUE(tile != nullptr);
+
+  // Settle the tile: full hp, no snow, moisture at its calm equilibrium
+  AnomalyField calm(world.width(), world.height());
+  for (unsigned i = 0; i < 10; ++i) {
+    tile->cycle_turn(calm, location, SUMMER);
+  }
+  tile->set_snowpack(0);
+  tile->set_soil_moisture(1.0);
+
+  // A turn without anomalies changes none of the yield's inputs
+  const unsigned version = tile->yield_version();
+  tile->cycle_turn(calm, location, SUMMER);
+  EXPECT_EQ(version, tile->yield_version());
+
+  // But recovering from damage does
+  tile->damage(0.5);
+  const unsigned damaged_version = tile->yield_version();
+  tile->cycle_turn(calm, location, SUMMER);
+  EXPECT_NE(damaged_version, tile->yield_version());
+}
+
+TEST(World, CastTracking)
+{
+  using namespace baal;
+
+  auto engine = create_engine();
+  World& world = engine->world();
+  WorldTile& tile  = world.get_tile(Location(0, 0));
+  WorldTile& other = world.get_tile(Location(0, 1));
+
+  tile.cast(FIRE_SPELL);
+  tile.cast(ASTEROID_SPELL);
+  EXPECT_TRUE(tile.already_casted(FIRE_SPELL));
+  EXPECT_TRUE(tile.already_casted(ASTEROID_SPELL));
+  EXPECT_FALSE(tile.already_casted(HOT_SPELL));
+  EXPECT_FALSE(other.already_casted(FIRE_SPELL));
+  EXPECT_THROW(tile.cast(FIRE_SPELL), ProgramError);
+
+  // Every cast on the map is forgotten at the next turn
+  world.cycle_turn();
+  EXPECT_FALSE(tile.already_casted(FIRE_SPELL));
+  EXPECT_FALSE(tile.already_casted(ASTEROID_SPELL));
+  tile.cast(FIRE_SPELL);
+  EXPECT_TRUE(tile.already_casted(FIRE_SPELL));
+}
+
 }
@@ -0,0 +1,99 @@
+#include "WorldFactoryFromFile.hpp"
+#include "InterfaceFactory.hpp"
+#include "Engine.hpp"
+#include "World.hpp"
+#include "Geology.hpp"
+#include "BaalExceptions.hpp"
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+
+namespace {
+
+const char* TEST_MAP_FILE = "UnitTestWorldFactoryFromFile.baalmap";
+
+void write_map(const std::string& contents)
+{
+  std::ofstream out(TEST_MAP_FILE);
+  out << contents;
+}
+
+TEST(WorldFactoryFromFile, Basic)
+{
+  using namespace baal;
+
+  // Cities may come before their tile; climate can be given per season
+  write_map(
+    "<?xml version=\"1.0\"?>\n"
+    "<baalmap>\n"
+    "  <map_width>2</map_width>\n"
+    "  <map_height>1</map_height>\n"
+    "  <city><row>0</row><col>1</col><name>Here</name></city>\n"
+    "  <tile>\n"
+    "    <row>0</row><col>0</col><type>OceanTile</type><depth>500</depth>\n"
+    "    <Climate>\n"
+    "      <temperature>30 40 50 60</temperature>\n"
+    "      <precip>5</precip>\n"
+    "      <Wind><speed>10</speed><direction>NE</direction></Wind>\n"
+    "    </Climate>\n"
+    "    <Geology><type>Subducting</type><plate_movement>2.0</plate_movement></Geology>\n"
+    "  </tile>\n"
+    "  <tile>\n"
+    "    <!-- comments are skipped -->\n"
+    "    <row>0</row><col>1</col><type>PlainsTile</type><elevation>100</elevation>\n"
+    "    <Climate><temperature>70</temperature><rainfall>12</rainfall>"
+    "<Wind><speed>5</speed><direction>S</direction></Wind></Climate>\n"
+    "    <Geology><type>Inactive</type></Geology>\n"
+    "  </tile>\n"
+    "</baalmap>\n");
+
+  auto engine = create_engine(Configuration(InterfaceFactory::HEADLESS_INTERFACE, TEST_MAP_FILE));
+  std::remove(TEST_MAP_FILE);
+  const World& world = engine->world();
+
+  EXPECT_EQ(2u, world.width());
+  EXPECT_EQ(1u, world.height());
+
+  const WorldTile& ocean = world.get_tile(Location(0, 0));
+  EXPECT_EQ(OCEAN, ocean.type());
+  EXPECT_EQ(500u, ocean.depth());
+  EXPECT_EQ(30, ocean.climate().temperature(WINTER));
+  EXPECT_EQ(60, ocean.climate().temperature(FALL));
+  EXPECT_EQ(5.0, ocean.climate().precip(SUMMER));
+  EXPECT_EQ(Wind(10, NE), ocean.climate().wind(SPRING));
+  EXPECT_EQ(2.0, ocean.geology().plate_movement());
+
+  const WorldTile& plains = world.get_tile(Location(0, 1));
+  EXPECT_EQ(PLAINS, plains.type());
+  EXPECT_EQ(100u, plains.elevation());
+  EXPECT_EQ(70, plains.climate().temperature(SUMMER));
+  EXPECT_EQ(12.0, plains.climate().precip(WINTER));
+
+  ASSERT_EQ(1u, world.cities().size());
+  EXPECT_EQ("Here", world.cities()[0]->name());
+  EXPECT_EQ(plains.city(), world.cities()[0]);
+}
+
+TEST(WorldFactoryFromFile, Errors)
+{
+  using namespace baal;
+
+  const Configuration config(InterfaceFactory::HEADLESS_INTERFACE, TEST_MAP_FILE);
+
+  // Size must be known before the first tile
+  write_map("<baalmap><tile><row>0</row></tile></baalmap>");
+  EXPECT_THROW(create_engine(config), UserError);
+
+  // Every tile must be present
+  write_map("<baalmap><map_width>2</map_width><map_height>2</map_height></baalmap>");
+  EXPECT_THROW(create_engine(config), UserError);
+
+  // Not a map at all
+  write_map("<world></world>");
+  EXPECT_THROW(create_engine(config), UserError);
+
+  std::remove(TEST_MAP_FILE);
+}
+
+}
@@ -0,0 +1,81 @@
+#include "WorldFactoryGenerated.hpp"
+#include "InterfaceFactory.hpp"
+#include "Engine.hpp"
+#include "World.hpp"
+#include "BaalExceptions.hpp"
+#include "Geology.hpp"
+#include "Weather.hpp"
+
+#include <gtest/gtest.h>
+#include <set>
+
+namespace {
+
+TEST(WorldFactoryGenerated, Basic)
+{
+  using namespace baal;
+
+  auto engine = create_engine(Configuration(InterfaceFactory::HEADLESS_INTERFACE, "g40x20:5"));
+  const World& world = engine->world();
+
+  EXPECT_EQ(40u, world.width());
+  EXPECT_EQ(20u, world.height());
+  EXPECT_EQ(5u, world.seed());
+  ASSERT_EQ(1u, world.cities().size());
+
+  // The same seed always gives the same world
+  auto same = create_engine(Configuration(InterfaceFactory::HEADLESS_INTERFACE, "g40x20:5"));
+  for (unsigned row = 0; row < world.height(); ++row) {
+    for (unsigned col = 0; col < world.width(); ++col) {
+      const Location location(row, col);
+      const WorldTile& tile  = world.get_tile(location);
+      const WorldTile& other = same->world().get_tile(location);
+      EXPECT_EQ(tile.type(), other.type());
+      EXPECT_EQ(tile.climate().temperature(SUMMER), other.climate().temperature(SUMMER));
+    }
+  }
+
+  // Default size
+  auto defaulted = create_engine(Configuration(InterfaceFactory::HEADLESS_INTERFACE, "g"));
+  EXPECT_EQ(WorldFactoryGenerated::DEFAULT_WIDTH,  defaulted->world().width());
+  EXPECT_EQ(WorldFactoryGenerated::DEFAULT_HEIGHT, defaulted->world().height());
+}
+
+TEST(WorldFactoryGenerated, LargeWorld)
+{
+  using namespace baal;
+
+  // What tiles have in common is not built once per tile: climates are
+  // interned per band of rows, and geologies are shared between tiles
+  const std::size_t num_climates = ClimateTable::size();
+  auto engine = create_engine(Configuration(InterfaceFactory::HEADLESS_INTERFACE, "g512x512:3"));
+  const World& world = engine->world();
+  const unsigned num_tiles = world.width() * world.height();
+
+  EXPECT_LT(ClimateTable::size() - num_climates, num_tiles / 16);
+
+  std::set<const Geology*> geologies;
+  for (unsigned row = 0; row < world.height(); ++row) {
+    for (unsigned col = 0; col < world.width(); ++col) {
+      const Geology& geology = world.get_tile(Location(row, col)).geology();
+      EXPECT_TRUE(geology.shared());
+      geologies.insert(&geology);
+    }
+  }
+  EXPECT_LT(geologies.size(), 1000u);
+}
+
+TEST(WorldFactoryGenerated, BadConfig)
+{
+  using namespace baal;
+
+  EXPECT_THROW(create_engine(Configuration(InterfaceFactory::HEADLESS_INTERFACE, "g5y3")), UserError);
+  EXPECT_THROW(create_engine(Configuration(InterfaceFactory::HEADLESS_INTERFACE, "g0x3")), UserError);
+  EXPECT_THROW(create_engine(Configuration(InterfaceFactory::HEADLESS_INTERFACE, "g5x3:")), UserError);
+
+  // Sizes whose tile count would overflow, or that exceed the largest world
+  EXPECT_THROW(create_engine(Configuration(InterfaceFactory::HEADLESS_INTERFACE, "g70000x70000")), UserError);
+  EXPECT_THROW(create_engine(Configuration(InterfaceFactory::HEADLESS_INTERFACE, "g40000x2")), UserError);
+}
+
+}